@@ -552,6 +552,9 @@ private:
 
     static PyObject *sCheckAbort(PyObject *self,PyObject *args);
     static PyObject *sSilenceSequencer(PyObject *self, PyObject *args);
+
+    static PyObject *sStartProfiler(PyObject *self, PyObject *args);
+    static PyObject *sStopProfiler(PyObject *self, PyObject *args);
     static PyMethodDef    Methods[];
 
     friend class ApplicationObserver;
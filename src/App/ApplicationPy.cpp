@@ -45,6 +45,7 @@
 #include <Base/FileInfo.h>
 #include <Base/UnitsApi.h>
 #include <Base/Sequencer.h>
+#include <Base/Profiler.h>
 
 //using Base::GetConsole;
 using namespace Base;
@@ -189,6 +190,14 @@ PyMethodDef Application::Methods[] = {
      "trigger a RuntimeError exception."},
     {"silenceSequencer", (PyCFunction) Application::sSilenceSequencer, METH_VARARGS,
      "silenceSequencer(enable = True : Bool) -- suppress progress sequencer output"},
+    {"startProfiler", (PyCFunction) Application::sStartProfiler, METH_VARARGS,
+     "startProfiler() -- start capturing profiling zones\n\n"
+     "Any previously captured zones are discarded."},
+    {"stopProfiler", (PyCFunction) Application::sStopProfiler, METH_VARARGS,
+     "stopProfiler(filename=None) -- stop capturing profiling zones\n\n"
+     "filename: if given, write the captured zones to this file in Chrome trace-event\n"
+     "          JSON format, which can be loaded in chrome://tracing or https://ui.perfetto.dev\n"
+     "Returns the number of captured events."},
     {NULL, NULL, 0, NULL}		/* Sentinel */
 };
 
@@ -982,6 +991,29 @@ PyObject *Application::sSilenceSequencer(PyObject * /*self*/, PyObject *args)
     Py_Return;
 }
 
+PyObject *Application::sStartProfiler(PyObject * /*self*/, PyObject *args)
+{
+    if (!PyArg_ParseTuple(args, ""))
+        return 0;
+    Base::Profiler::instance().start();
+    Py_Return;
+}
+
+PyObject *Application::sStopProfiler(PyObject * /*self*/, PyObject *args)
+{
+    const char *filename = nullptr;
+    if (!PyArg_ParseTuple(args, "|z", &filename))
+        return 0;
+
+    PY_TRY {
+        auto &profiler = Base::Profiler::instance();
+        profiler.stop();
+        if (filename)
+            profiler.exportTrace(filename);
+        return Py::new_reference_to(Py::Int(static_cast<long>(profiler.eventCount())));
+    } PY_CATCH;
+}
+
 PyObject *Application::sDumpSWIG(PyObject * /*self*/, PyObject *args)
 {
     if (!PyArg_ParseTuple(args, ""))
@@ -24,7 +24,10 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <climits>
+# include <cstdint>
 # include <cstdlib>
+# include <iterator>
 #endif
 
 #include <boost/algorithm/string/predicate.hpp>
@@ -45,6 +48,7 @@
 #include <App/DocumentObject.h>
 #include "Application.h"
 #include "Document.h"
+#include "DocumentParams.h"
 #include "ComplexGeoData.h"
 #include "MappedElement.h"
 
@@ -224,6 +228,88 @@ inline std::ostream & operator << (std::ostream &s, const QByteArray &bytes)
     return s;
 }
 
+// Helpers for the binary element map format. Unsigned integers are written as
+// little endian base 128 variable length integers, and signed integers are
+// zigzag encoded before that, so that small values take a single byte.
+static void writeVarint(std::string &s, std::uint64_t v)
+{
+    while (v >= 0x80) {
+        s.push_back(static_cast<char>((v & 0x7f) | 0x80));
+        v >>= 7;
+    }
+    s.push_back(static_cast<char>(v));
+}
+
+static void writeSignedVarint(std::string &s, std::int64_t v)
+{
+    writeVarint(s, (static_cast<std::uint64_t>(v) << 1)
+                    ^ static_cast<std::uint64_t>(v >> 63));
+}
+
+static void writeBytes(std::string &s, const char *data, std::size_t size)
+{
+    writeVarint(s, size);
+    s.append(data, size);
+}
+
+static void writeStringIDs(std::string &s, const ElementIDRefs &sids, long skip = 0)
+{
+    int count = 0;
+    for (auto & sid : sids) {
+        if (sid.isMarked() && sid.value() != skip)
+            ++count;
+    }
+    writeVarint(s, count);
+    for (auto & sid : sids) {
+        if (sid.isMarked() && sid.value() != skip)
+            writeVarint(s, sid.value());
+    }
+}
+
+struct BinaryInput
+{
+    const char *cur;
+    const char *end;
+
+    std::uint64_t varint()
+    {
+        std::uint64_t res = 0;
+        for (int shift=0; shift<64; shift+=7) {
+            if (cur == end)
+                FC_THROWM(Base::RuntimeError, "unexpected end of element map");
+            auto c = static_cast<unsigned char>(*cur++);
+            res |= static_cast<std::uint64_t>(c & 0x7f) << shift;
+            if (!(c & 0x80))
+                return res;
+        }
+        FC_THROWM(Base::RuntimeError, "Invalid element map integer");
+    }
+
+    int integer()
+    {
+        std::uint64_t v = varint();
+        if (v > INT_MAX)
+            FC_THROWM(Base::RuntimeError, "Element map integer out of range");
+        return static_cast<int>(v);
+    }
+
+    std::int64_t signedVarint()
+    {
+        std::uint64_t v = varint();
+        return static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1);
+    }
+
+    const char *bytes(int &size)
+    {
+        size = integer();
+        if (size > end - cur)
+            FC_THROWM(Base::RuntimeError, "unexpected end of element map");
+        const char *res = cur;
+        cur += size;
+        return res;
+    }
+};
+
 // Because the existence of hierarchical element maps, for the same document
 // we may store an element map more than once in multiple objects. And because
 // we may want to support partial loading, we choose to tolerate such redundancy
@@ -515,6 +601,313 @@ public:
         return restore(hasher, s, childMaps, postfixes);
     }
 
+    // Binary counterpart of save(). The layout follows the text format, except
+    // that element types and postfixes are referred by their index in the
+    // postfix table, string IDs are written as plain integers, and each child
+    // map is prefixed with its byte size, so that a map already restored from
+    // another file can be skipped without parsing.
+    void saveBinary(std::string &s,
+                    const std::map<const ElementMap*,int> &childMapSet,
+                    const std::map<QByteArray, int> &postfixMap) const
+    {
+        writeVarint(s, this->_id);
+        writeVarint(s, this->indexedNames.size());
+
+        for (auto & v : this->indexedNames) {
+            // Element types are always added to the postfix table by collectChildMaps()
+            auto typeIt = postfixMap.find(QByteArray::fromRawData(v.first, qstrlen(v.first)));
+            assert(typeIt != postfixMap.end());
+            writeVarint(s, typeIt->second);
+
+            writeVarint(s, v.second.children.size());
+            for (auto & vv : v.second.children) {
+                auto & child = vv.second;
+                int mapIndex = 0;
+                if (child.elementMap) {
+                    auto it = childMapSet.find(child.elementMap.get());
+                    if (it == childMapSet.end() || it->second == 0)
+                        FC_ERR("Invalid child element map");
+                    else
+                        mapIndex = it->second;
+                }
+                writeVarint(s, child.indexedName.getIndex());
+                writeVarint(s, child.offset);
+                writeVarint(s, child.count);
+                writeSignedVarint(s, child.tag);
+                writeVarint(s, mapIndex);
+                writeBytes(s, child.postfix.constData(), child.postfix.size());
+                writeStringIDs(s, child.sids);
+            }
+
+            writeVarint(s, v.second.names.size());
+            for (auto & ref : v.second.names) {
+                int count = 0;
+                for (auto r = &ref; r && r->name; r=r->next.get())
+                    ++count;
+                writeVarint(s, count);
+
+                for (auto r = &ref; r && r->name; r=r->next.get()) {
+                    App::StringID::IndexID prefixid;
+                    prefixid.id = 0;
+                    IndexedName idx(r->name.dataBytes());
+                    bool saveName = true;
+                    if (idx) {
+                        auto key = QByteArray::fromRawData(idx.getType(), qstrlen(idx.getType()));
+                        auto it = postfixMap.find(key);
+                        if (it != postfixMap.end()) {
+                            writeVarint(s, 0);
+                            writeVarint(s, it->second);
+                            writeVarint(s, idx.getIndex());
+                            saveName = false;
+                        }
+                    } else {
+                        prefixid = App::StringID::fromString(r->name.dataBytes());
+                        if (prefixid.id) {
+                            for (auto & sid : r->sids) {
+                                if (sid.isMarked() && sid.value() == prefixid.id) {
+                                    writeVarint(s, 1);
+                                    saveName = false;
+                                    break;
+                                }
+                            }
+                            if (saveName)
+                                prefixid.id = 0;
+                        }
+                    }
+                    if (saveName)
+                        writeVarint(s, 2);
+                    if (saveName || prefixid.id) {
+                        const QByteArray & bytes = r->name.dataBytes();
+                        writeBytes(s, bytes.constData(), bytes.size());
+                    }
+
+                    const QByteArray & postfix = r->name.postfixBytes();
+                    if (postfix.isEmpty())
+                        writeVarint(s, 0);
+                    else {
+                        auto it = postfixMap.find(postfix);
+                        assert(it != postfixMap.end());
+                        writeVarint(s, it->second);
+                    }
+                    writeStringIDs(s, r->sids, prefixid.id);
+                }
+            }
+        }
+    }
+
+    void saveBinary(std::ostream &s) const {
+        std::map<const ElementMap*, int> childMapSet;
+        std::vector<const ElementMap*> childMaps;
+        std::map<QByteArray, int> postfixMap;
+        std::vector<QByteArray> postfixes;
+
+        collectChildMaps(childMapSet, childMaps, postfixMap, postfixes);
+
+        std::string buffer;
+        writeVarint(buffer, this->_id);
+        writeVarint(buffer, postfixes.size());
+        for (auto & p : postfixes)
+            writeBytes(buffer, p.constData(), p.size());
+
+        std::string body;
+        writeVarint(buffer, childMaps.size());
+        for (auto & elementMap : childMaps) {
+            body.clear();
+            elementMap->saveBinary(body, childMapSet, postfixMap);
+            writeBytes(buffer, body.data(), body.size());
+        }
+        s.write(buffer.data(), buffer.size());
+    }
+
+    ElementMapPtr restoreBinary(App::StringHasherRef hasher, const char *data, std::size_t size)
+    {
+        BinaryInput in{data, data + size};
+
+        unsigned id = static_cast<unsigned>(in.integer());
+        auto & map = _IdToElementMap[id];
+        if (map)
+            return map;
+
+        int count = in.integer();
+        std::vector<std::string> postfixes;
+        postfixes.reserve(count);
+        for (int i=0; i<count; ++i) {
+            int len;
+            const char *bytes = in.bytes(len);
+            postfixes.emplace_back(bytes, len);
+        }
+
+        count = in.integer();
+        if (count == 0)
+            FC_THROWM(Base::RuntimeError, "Invalid element map");
+
+        std::vector<ElementMapPtr> childMaps;
+        childMaps.reserve(count-1);
+        for (int i=0; i<count; ++i) {
+            int len;
+            const char *bytes = in.bytes(len);
+            BinaryInput body{bytes, bytes + len};
+            ElementMapPtr elementMap = i == count-1 ?
+                shared_from_this() : std::make_shared<ElementMap>();
+            elementMap = elementMap->restoreBinary(hasher, body, childMaps, postfixes, i+1);
+            if (i == count-1)
+                return elementMap;
+            childMaps.push_back(elementMap);
+        }
+        return shared_from_this();
+    }
+
+    ElementMapPtr restoreBinary(App::StringHasherRef hasher,
+                                BinaryInput &in,
+                                std::vector<ElementMapPtr> &childMaps,
+                                const std::vector<std::string> &postfixes,
+                                int index)
+    {
+        unsigned id = static_cast<unsigned>(in.integer());
+        auto & map = _IdToElementMap[id];
+        if (map)
+            return map;
+        map = shared_from_this();
+
+        const char *hasherWarn = nullptr;
+        const char *hasherIDWarn = nullptr;
+        const char *postfixWarn = nullptr;
+        const char *childSIDWarn = nullptr;
+
+        int typeCount = in.integer();
+        for (int i=0; i<typeCount; ++i) {
+            int n = in.integer();
+            if (n <= 0 || n > (int)postfixes.size())
+                FC_THROWM(Base::RuntimeError, "missing element type");
+            IndexedName idx(postfixes[n-1].c_str(), 1);
+
+            auto & indices = this->indexedNames[idx.getType()];
+            int count = in.integer();
+            for (int j=0; j<count; ++j) {
+                int cindex = in.integer();
+                int offset = in.integer();
+                int ccount = in.integer();
+                long tag = static_cast<long>(in.signedVarint());
+                int mapIndex = in.integer();
+                int len;
+                const char *postfix = in.bytes(len);
+                if (mapIndex >= index || mapIndex > (int)childMaps.size())
+                    FC_THROWM(Base::RuntimeError, "Invalid element child map index");
+                auto & child = indices.children[cindex+offset+ccount];
+                child.indexedName = IndexedName::fromConst(idx.getType(), cindex);
+                child.offset = offset;
+                child.count = ccount;
+                child.tag = tag;
+                if (mapIndex > 0)
+                    child.elementMap = childMaps[mapIndex-1];
+                else
+                    child.elementMap = nullptr;
+                child.postfix = QByteArray(postfix, len);
+                this->childElements[child.postfix].childMap = &child;
+                this->childElementSize += child.count;
+
+                int sidCount = in.integer();
+                child.sids.reserve(sidCount);
+                for (int k=0; k<sidCount; ++k) {
+                    long id = static_cast<long>(in.varint());
+                    auto sid = hasher ? hasher->getID(id) : App::StringIDRef();
+                    if (!sid)
+                        childSIDWarn = "Missing element child string id";
+                    else
+                        child.sids.push_back(sid);
+                }
+            }
+
+            count = in.integer();
+            indices.names.resize(count);
+            for (int j=0; j<count; ++j) {
+                idx.setIndex(j);
+                auto * ref = & indices.names[j];
+                int entryCount = in.integer();
+                for (int k=0; k<entryCount; ++k) {
+                    if (k != 0) {
+                        ref->next.reset(new MappedNameRef);
+                        ref = ref->next.get();
+                    }
+
+                    App::StringID::IndexID prefixid;
+                    prefixid.id = 0;
+                    int len;
+                    const char *bytes;
+                    switch(in.integer()) {
+                    case 0: {
+                        int n = in.integer();
+                        if (n <= 0 || n > (int)postfixes.size())
+                            FC_THROWM(Base::RuntimeError, "Invalid element name index");
+                        int m = in.integer();
+                        ref->name = MappedName(IndexedName::fromConst(postfixes[n-1].c_str(), m));
+                        break;
+                    }
+                    case 1:
+                        bytes = in.bytes(len);
+                        ref->name = MappedName(bytes, len);
+                        prefixid = App::StringID::fromString(ref->name.dataBytes());
+                        break;
+                    case 2:
+                        bytes = in.bytes(len);
+                        ref->name = MappedName(bytes, len);
+                        break;
+                    default:
+                        FC_THROWM(Base::RuntimeError, "Invalid element name marker");
+                    }
+
+                    int n = in.integer();
+                    if (n) {
+                        if (n > (int)postfixes.size())
+                            postfixWarn = "Invalid element postfix index";
+                        else
+                            ref->name += postfixes[n-1];
+                    }
+
+                    this->mappedNames.emplace(ref->name, idx);
+
+                    int sidCount = in.integer();
+                    if (!hasher) {
+                        if (sidCount)
+                            hasherWarn = "No hasher";
+                        for (int l=0; l<sidCount; ++l)
+                            in.varint();
+                        continue;
+                    }
+
+                    ref->sids.reserve(sidCount + (prefixid.id ? 1 : 0));
+                    if (prefixid.id) {
+                        auto sid = hasher->getID(prefixid.id);
+                        if (!sid)
+                            hasherIDWarn = "Missing element name prefix id";
+                        else
+                            ref->sids.push_back(sid);
+                    }
+                    for (int l=0; l<sidCount; ++l) {
+                        auto sid = hasher->getID(static_cast<long>(in.varint()));
+                        if (!sid)
+                            hasherIDWarn = "Invalid element name string id";
+                        else
+                            ref->sids.push_back(sid);
+                    }
+                }
+            }
+        }
+        if (hasherWarn)
+            FC_WARN(hasherWarn);
+        if (hasherIDWarn)
+            FC_WARN(hasherIDWarn);
+        if (postfixWarn)
+            FC_WARN(postfixWarn);
+        if (childSIDWarn)
+            FC_WARN(childSIDWarn);
+
+        if (in.cur != in.end)
+            FC_THROWM(Base::RuntimeError, "unexpected end of child element map");
+
+        return shared_from_this();
+    }
+
     ElementMapPtr restore(App::StringHasherRef hasher,
                           std::istream &s,
                           std::vector<ElementMapPtr> &childMaps,
@@ -2060,7 +2453,8 @@ void ComplexGeoData::Save(Base::Writer &writer) const {
 
     if(_PersistenceName.size()) {
         writer.Stream() << " file=\"" 
-            << writer.addFile(_PersistenceName+".txt",this) 
+            << writer.addFile(_PersistenceName
+                    + (App::DocumentParams::getBinaryElementMap() ? ".bin" : ".txt"), this)
             << "\"/>\n";
         return;
     }
@@ -2195,8 +2589,13 @@ void ComplexGeoData::restoreStream(std::istream &s, std::size_t count) {
 void ComplexGeoData::SaveDocFile(Base::Writer &writer) const {
     flushElementMap();
     if (_ElementMap) {
-        writer.Stream() << "BeginElementMap v1\n";
-        _ElementMap->save(writer.Stream());
+        if (App::DocumentParams::getBinaryElementMap()) {
+            writer.Stream() << "BeginElementMap v2\n";
+            _ElementMap->saveBinary(writer.Stream());
+        } else {
+            writer.Stream() << "BeginElementMap v1\n";
+            _ElementMap->save(writer.Stream());
+        }
     }
 }
 
@@ -2206,6 +2605,16 @@ void ComplexGeoData::RestoreDocFile(Base::Reader &reader) {
     if (boost::equals(marker, "BeginElementMap")) {
         resetElementMap();
         reader >> ver;
+        if (ver == "v2") {
+            // Skip the new line after the marker, and read the rest of the
+            // file in one go, which is much faster than parsing the stream.
+            reader.get();
+            std::string buffer((std::istreambuf_iterator<char>(reader)),
+                               std::istreambuf_iterator<char>());
+            resetElementMap(std::make_shared<ElementMap>());
+            _ElementMap = _ElementMap->restoreBinary(Hasher, buffer.data(), buffer.size());
+            return;
+        }
         if (ver != "v1")
             FC_WARN("Unknown element map format");
         else {
@@ -66,6 +66,7 @@ recompute path. Also, it enables more complicated dependencies beyond trees.
 # include <climits>
 # include <bitset>
 # include <random>
+# include <chrono>
 # include <boost/filesystem.hpp>
 #endif
 
@@ -86,9 +87,19 @@ recompute path. Also, it enables more complicated dependencies beyond trees.
 
 #include <boost_bind_bind.hpp>
 #include <boost/regex.hpp>
+#include <boost/functional/hash.hpp>
 #include <unordered_set>
 #include <unordered_map>
 #include <random>
+#include <atomic>
+#include <mutex>
+
+#if defined(FC_OS_LINUX)
+# include <cstdio>
+# include <unistd.h>
+#elif defined(FC_OS_MACOSX)
+# include <mach/mach.h>
+#endif
 
 #include <QMap>
 #include <QFileInfo>
@@ -107,6 +118,8 @@ recompute path. Also, it enables more complicated dependencies beyond trees.
 #include <Base/Console.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
+#include <Base/Matrix.h>
+#include <Base/Profiler.h>
 #include <Base/TimeInfo.h>
 #include <Base/Interpreter.h>
 #include <Base/Reader.h>
@@ -174,6 +187,101 @@ typedef boost::bimap<StringHasherRef,int> HasherMap;
 
 static bool _IsRestoring;
 
+// Bumped on any change that may affect sub-object resolution in any document
+static std::atomic<long> _SubObjectCacheRevision;
+
+struct SubObjectCacheKey {
+    const DocumentObject *obj;
+    std::string subname;
+    bool transform;
+
+    bool operator==(const SubObjectCacheKey &other) const {
+        return obj == other.obj && transform == other.transform
+            && subname == other.subname;
+    }
+};
+
+struct SubObjectCacheHasher {
+    std::size_t operator()(const SubObjectCacheKey &key) const {
+        std::size_t seed = std::hash<std::string>()(key.subname);
+        boost::hash_combine(seed, key.obj);
+        boost::hash_combine(seed, key.transform);
+        return seed;
+    }
+};
+
+// Copies of the properties changed by a recompute, taken right before their
+// first change, used to restore the state before recompute when the user
+// aborts. The snapshot registers itself in the given slot while it exists.
+class RecomputeSnapshot
+{
+public:
+    RecomputeSnapshot(RecomputeSnapshot *&slot)
+        :slot(slot)
+    {
+        slot = this;
+    }
+
+    ~RecomputeSnapshot()
+    {
+        slot = nullptr;
+    }
+
+    void addObject(DocumentObject *obj)
+    {
+        objects.emplace_back(obj);
+    }
+
+    void addProperty(const DocumentObject *obj, const Property *prop)
+    {
+        if (!prop->getName() || !props.insert(prop).second)
+            return;
+        entries.emplace_back();
+        auto &entry = entries.back();
+        entry.obj = obj;
+        entry.name = prop->getName();
+        entry.copy.reset(prop->Copy());
+    }
+
+    void restore()
+    {
+        // stop recording, restoring changes the properties again
+        slot = nullptr;
+        for (auto it = entries.rbegin(); it != entries.rend(); ++it) {
+            auto obj = it->obj.getObject();
+            if (!obj)
+                continue;
+            auto prop = obj->getPropertyByName(it->name.c_str());
+            if (prop && prop->getTypeId() == it->copy->getTypeId() && !prop->isSame(*it->copy))
+                prop->Paste(*it->copy);
+        }
+        for (auto &o : objects) {
+            if (auto obj = o.getObject())
+                obj->enforceRecompute();
+        }
+        entries.clear();
+        objects.clear();
+        props.clear();
+    }
+
+    bool empty() const
+    {
+        return objects.empty();
+    }
+
+private:
+    struct Entry
+    {
+        DocumentObjectT obj;
+        std::string name;
+        std::unique_ptr<Property> copy;
+    };
+    RecomputeSnapshot *&slot;
+    std::vector<DocumentObjectT> objects;
+    std::vector<Entry> entries;
+    std::unordered_set<const Property*> props;
+};
+
 // Pimpl class
 struct DocumentP
 {
@@ -185,6 +293,7 @@ struct DocumentP
     std::unordered_map<std::string, bool> partialLoadObjects;
     std::vector<DocumentObjectT> pendingRemove;
     std::vector<App::DocumentObject*> skippedObjs;
+    RecomputeSnapshot *recomputeSnapshot = nullptr;
     long lastObjectId;
     mutable std::pair<long, long> treeRanks = std::make_pair(0,0);
     long treeRankRevision = 0;
@@ -215,6 +324,20 @@ struct DocumentP
     // restored files
     std::set<std::string> files;
 
+    std::mutex subObjectCacheMutex;
+    long subObjectCacheRevision = 0;
+    std::unordered_map<SubObjectCacheKey,
+                       std::pair<DocumentObject*, Base::Matrix4D>,
+                       SubObjectCacheHasher> subObjectCache;
+
+    // Objects of a type and its derived types in creation order, indexed
+    // by type key. An entry is created on first query and kept up to date
+    // on object addition and removal.
+    mutable std::unordered_map<unsigned int, std::vector<DocumentObject*> > typeIndex;
+    // Objects by label, built on first query and kept up to date afterwards
+    mutable std::unordered_multimap<std::string, DocumentObject*> labelIndex;
+    mutable bool labelIndexValid = false;
+
     DocumentP() {
 #ifndef FC_DEBUG
         static std::random_device _RD;
@@ -255,10 +378,72 @@ struct DocumentP
             break;
         }
         ++revision;
+        Document::clearSubObjectCache();
         this->objectArray.push_back(pcObject);
+        indexObject(pcObject);
         return id ? id : this->lastObjectId;
     }
 
+    void indexObject(App::DocumentObject *pcObject) {
+        if (!typeIndex.empty()) {
+            for (auto type = pcObject->getTypeId(); !type.isBad(); type = type.getParent()) {
+                auto it = typeIndex.find(type.getKey());
+                if (it != typeIndex.end())
+                    it->second.push_back(pcObject);
+            }
+        }
+        if (labelIndexValid)
+            labelIndex.emplace(pcObject->Label.getStrValue(), pcObject);
+    }
+
+    void unindexObject(App::DocumentObject *pcObject) {
+        if (!typeIndex.empty()) {
+            for (auto type = pcObject->getTypeId(); !type.isBad(); type = type.getParent()) {
+                auto it = typeIndex.find(type.getKey());
+                if (it == typeIndex.end())
+                    continue;
+                auto &objs = it->second;
+                auto iter = std::find(objs.begin(), objs.end(), pcObject);
+                if (iter != objs.end())
+                    objs.erase(iter);
+            }
+        }
+        if (labelIndexValid && !eraseLabel(pcObject->Label.getStrValue(), pcObject))
+            clearLabelIndex();
+    }
+
+    bool eraseLabel(const std::string &label, App::DocumentObject *pcObject) {
+        auto range = labelIndex.equal_range(label);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == pcObject) {
+                labelIndex.erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void clearLabelIndex() {
+        labelIndex.clear();
+        labelIndexValid = false;
+    }
+
+    void clearIndex() {
+        typeIndex.clear();
+        clearLabelIndex();
+    }
+
+    const std::vector<DocumentObject*> &objectsOfType(const Base::Type &typeId) const {
+        auto res = typeIndex.emplace(typeId.getKey(), std::vector<DocumentObject*>());
+        if (res.second) {
+            for (auto obj : objectArray) {
+                if (obj->getTypeId().isDerivedFrom(typeId))
+                    res.first->second.push_back(obj);
+            }
+        }
+        return res.first->second;
+    }
+
     void addRecomputeLog(const char *why, App::DocumentObject *obj) {
         addRecomputeLog(new DocumentObjectExecReturn(why,obj));
     }
@@ -1297,6 +1482,18 @@ void Document::_commitTransaction(bool notify)
             delete mUndoTransactions.front();
             mUndoTransactions.pop_front();
         }
+        // and the memory limit if there is one, but always keep the last step
+        if (d->UndoMemSize) {
+            std::vector<unsigned int> undoSizes;
+            unsigned int size = getUndoMemSize(&undoSizes);
+            for (auto it = undoSizes.begin();
+                    mUndoTransactions.size() > 1 && size > d->UndoMemSize; ++it) {
+                size -= *it;
+                mUndoMap.erase(mUndoTransactions.front()->getID());
+                delete mUndoTransactions.front();
+                mUndoTransactions.pop_front();
+            }
+        }
         signalCommitTransaction(*this);
 
         if (notify)
@@ -1388,6 +1585,7 @@ void Document::clearDocument()
     if(this->d->objectArray.size()) {
         GetApplication().signalDeleteDocument(*this);
         this->d->objectArray.clear();
+        this->d->clearIndex();
         decltype(this->d->objectMap) map = std::move(this->d->objectMap);
         this->d->objectMap.clear();
         this->d->objectIdMap.clear();
@@ -1404,6 +1602,7 @@ void Document::clearDocument()
 
     this->d->clearRecomputeLog();
     this->d->objectArray.clear();
+    this->d->clearIndex();
     this->d->objectMap.clear();
     this->d->objectIdMap.clear();
     this->d->lastObjectId = 0;
@@ -1494,7 +1693,30 @@ int Document::getUndoMode(void) const
 
 unsigned int Document::getUndoMemSize (void) const
 {
-    return d->UndoMemSize;
+    return getUndoMemSize(nullptr);
+}
+
+unsigned int Document::getUndoMemSize (std::vector<unsigned int> *undoSizes) const
+{
+    // The transactions cache their size, so this only sums up the steps. Data
+    // shared by several steps is counted once, for the newest step holding it,
+    // so that dropping the oldest undo steps frees what is listed for them.
+    std::set<const void*> shared;
+    unsigned int size = 0;
+    if (d->activeUndoTransaction)
+        size += d->activeUndoTransaction->getMemSize(shared);
+    for (auto transaction : mRedoTransactions)
+        size += transaction->getMemSize(shared);
+    if (undoSizes)
+        undoSizes->resize(mUndoTransactions.size());
+    std::size_t i = mUndoTransactions.size();
+    for (auto it = mUndoTransactions.rbegin(); it != mUndoTransactions.rend(); ++it) {
+        unsigned int s = (*it)->getMemSize(shared);
+        if (undoSizes)
+            (*undoSizes)[--i] = s;
+        size += s;
+    }
+    return size;
 }
 
 void Document::setUndoLimit(unsigned int UndoMemSize)
@@ -1584,6 +1806,8 @@ void Document::onBeforeChangeProperty(const TransactionalObject *Who, const Prop
         if (d->activeUndoTransaction)
             d->activeUndoTransaction->addObjectChange(Who,What);
     }
+    if (d->recomputeSnapshot && Who->isDerivedFrom(App::DocumentObject::getClassTypeId()))
+        d->recomputeSnapshot->addProperty(static_cast<const App::DocumentObject*>(Who), What);
 }
 
 void Document::onChangedProperty(const DocumentObject *Who, const Property *What)
@@ -1746,6 +1970,9 @@ Document::~Document()
 
     d->activeObject = nullptr;
     d->objectArray.clear();
+    d->clearIndex();
+    // Other documents may have cached links into this one
+    clearSubObjectCache();
     decltype(d->objectMap) map = std::move(d->objectMap);
     d->objectMap.clear();
     d->objectIdMap.clear();
@@ -3069,6 +3296,7 @@ void Document::restore(Base::XMLReader &reader,
         signal = true;
         GetApplication().signalDeleteDocument(*this);
         d->objectArray.clear();
+        d->clearIndex();
         for(auto &v : d->objectMap) {
             v.second->setStatus(ObjectStatus::Destroy, true);
             delete(v.second);
@@ -3083,6 +3311,7 @@ void Document::restore(Base::XMLReader &reader,
 
     d->clearRecomputeLog();
     d->objectArray.clear();
+    d->clearIndex();
     d->objectMap.clear();
     d->objectIdMap.clear();
     d->lastObjectId = 0;
@@ -3337,6 +3566,43 @@ int Document::countObjects(void) const
    return static_cast<int>(d->objectArray.size());
 }
 
+void Document::clearSubObjectCache()
+{
+    ++_SubObjectCacheRevision;
+}
+
+bool Document::getCachedSubObject(const DocumentObject *obj, const char *subname,
+        bool transform, DocumentObject *&ret, Base::Matrix4D &mat) const
+{
+    std::lock_guard<std::mutex> lock(d->subObjectCacheMutex);
+    long rev = _SubObjectCacheRevision;
+    if (d->subObjectCacheRevision != rev) {
+        d->subObjectCache.clear();
+        d->subObjectCacheRevision = rev;
+        return false;
+    }
+    auto it = d->subObjectCache.find(SubObjectCacheKey{obj, subname, transform});
+    if (it == d->subObjectCache.end())
+        return false;
+    ret = it->second.first;
+    mat = it->second.second;
+    return true;
+}
+
+void Document::setCachedSubObject(const DocumentObject *obj, const char *subname,
+        bool transform, DocumentObject *ret, const Base::Matrix4D &mat) const
+{
+    std::lock_guard<std::mutex> lock(d->subObjectCacheMutex);
+    // Something changed while resolving, the result may already be stale
+    if (d->subObjectCacheRevision != _SubObjectCacheRevision)
+        return;
+    // Element names make the key space unbounded, so just start over once
+    // the cache grows too large.
+    if ((long)d->subObjectCache.size() >= DocumentParams::getSubObjectCacheSize())
+        d->subObjectCache.clear();
+    d->subObjectCache[SubObjectCacheKey{obj, subname, transform}] = std::make_pair(ret, mat);
+}
+
 void Document::getLinksTo(std::set<DocumentObject*> &links,
         const DocumentObject *obj, int options, int maxCount,
         const std::vector<DocumentObject*> &objs) const
@@ -3878,6 +4144,7 @@ bool Document::isAnyRecomputing()
 
 int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool force, bool *hasError, int options)
 {
+    FC_PROFILE_ZONE_DETAIL("Document::recompute", "App", getName());
     RecomputeCounter counter;
 
     if (d->undoing || d->rollback) {
@@ -3941,6 +4208,10 @@ int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool forc
         obj->setStatus(ObjectStatus::PendingRecompute,true);
 
     bool canAbort = DocumentParams::getCanAbortRecompute();
+    bool aborted = false;
+    std::unique_ptr<RecomputeSnapshot> snapshot;
+    if (canAbort && DocumentParams::getRollbackAbortedRecompute())
+        snapshot.reset(new RecomputeSnapshot(d->recomputeSnapshot));
 
     std::set<App::DocumentObject *> filter;
     size_t idx = 0;
@@ -3963,11 +4234,16 @@ int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool forc
                 if (obj->mustRecompute()) {
                     doRecompute = true;
                     ++objectCount;
+                    if (seq)
+                        seq->setText((std::string("Recompute ") + obj->Label.getStrValue()).c_str());
+                    if (snapshot)
+                        snapshot->addObject(obj);
                     int res = _recomputeFeature(obj);
                     if(res) {
                         if(hasError)
                             *hasError = true;
                         if(res < 0) {
+                            aborted = true;
                             passes = 2;
                             break;
                         }
@@ -4020,10 +4296,23 @@ int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool forc
                 }
             }
         }
+    }catch(Base::AbortException &e) {
+        e.ReportException();
+        aborted = true;
     }catch(Base::Exception &e) {
         e.ReportException();
     }
 
+    if (aborted && snapshot && !snapshot->empty()) {
+        FC_WARN("Recompute of " << getName() << " aborted, restoring previous state");
+        try {
+            snapshot->restore();
+        } catch (Base::Exception &e) {
+            e.ReportException();
+        }
+    }
+    snapshot.reset();
+
     FC_TIME_LOG(t2, "Recompute");
 
     for(auto obj : topoSortedObjects) {
@@ -4254,9 +4543,85 @@ void Document::setErrorDescription(App::Property *Prop, const char *msg)
     }
 }
 
+namespace {
+
+// Return the current resident set size of the process in bytes, or 0 if unknown
+long long residentMemory()
+{
+#if defined(FC_OS_LINUX)
+    long long pages = 0;
+    FILE *file = std::fopen("/proc/self/statm", "r");
+    if (!file)
+        return 0;
+    if (std::fscanf(file, "%*s %lld", &pages) != 1)
+        pages = 0;
+    std::fclose(file);
+    return pages * static_cast<long long>(sysconf(_SC_PAGESIZE));
+#elif defined(FC_OS_MACOSX)
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+                  reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS)
+        return 0;
+    return static_cast<long long>(info.resident_size);
+#else
+    return 0;
+#endif
+}
+
+// Record the execution of an object into its RecomputeStats on destruction.
+// The memory change is only sampled if parameter RecomputeMemoryStats is on,
+// because reading it costs a system call or file read per object.
+class RecomputeTimer
+{
+public:
+    explicit RecomputeTimer(RecomputeStats &stats)
+        : stats(stats)
+        , memory(DocumentParams::getRecomputeMemoryStats() ? residentMemory() : 0)
+        , start(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~RecomputeTimer()
+    {
+        std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+        stats.add(duration.count(), memory ? residentMemory() - memory : 0);
+    }
+
+private:
+    RecomputeStats &stats;
+    long long memory;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // anonymous namespace
+
+std::vector<App::DocumentObject*> Document::getRecomputeReport(std::size_t limit) const
+{
+    std::vector<App::DocumentObject*> objs;
+    for (auto obj : d->objectArray) {
+        if (obj->getRecomputeStats().count)
+            objs.push_back(obj);
+    }
+    std::stable_sort(objs.begin(), objs.end(),
+        [](const App::DocumentObject *a, const App::DocumentObject *b) {
+            return a->getRecomputeStats().totalTime > b->getRecomputeStats().totalTime;
+        });
+    if (limit && objs.size() > limit)
+        objs.resize(limit);
+    return objs;
+}
+
+void Document::resetRecomputeStats()
+{
+    for (auto obj : d->objectArray)
+        obj->resetRecomputeStats();
+}
+
 // call the recompute of the Feature and handle the exceptions and errors.
 int Document::_recomputeFeature(DocumentObject* Feat)
 {
+    FC_PROFILE_ZONE_DETAIL("Document::_recomputeFeature", "App", Feat->getFullName());
     DocumentObjectExecReturn  *returnCode = DocumentObject::StdReturn;
     try {
         returnCode = Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteNonOutput);
@@ -4281,6 +4646,7 @@ int Document::_recomputeFeature(DocumentObject* Feat)
                 FC_LOG("Skip recomputing " << Feat->getFullName());
             } else {
                 Feat->_enforceRecompute = false;
+                RecomputeTimer timer(Feat->_recomputeStats);
                 returnCode = Feat->recompute();
             }
 
@@ -4705,9 +5071,11 @@ void Document::removeObject(const char* sName)
             break;
         }
     }
+    d->unindexObject(pos->second);
 
     d->objectMap.erase(pos);
     ++d->revision;
+    clearSubObjectCache();
 }
 
 /// Remove an object out of the document (internal)
@@ -4770,12 +5138,14 @@ void Document::_removeObject(DocumentObject* pcObject)
     pcObject->setStatus(ObjectStatus::Remove, false); // Unset the bit to be on the safe side
     d->objectIdMap.erase(pcObject->_Id);
     ++d->revision;
+    clearSubObjectCache();
     for (std::vector<DocumentObject*>::iterator it = d->objectArray.begin(); it != d->objectArray.end(); ++it) {
         if (*it == pcObject) {
             d->objectArray.erase(it);
             break;
         }
     }
+    d->unindexObject(pcObject);
 
     // for a rollback delete the object
     if (d->rollback) {
@@ -5151,14 +5521,40 @@ const std::vector<DocumentObject*> &Document::getObjects() const
 
 std::vector<DocumentObject*> Document::getObjectsOfType(const Base::Type& typeId) const
 {
-    std::vector<DocumentObject*> Objects;
-    for (std::vector<DocumentObject*>::const_iterator it = d->objectArray.begin(); it != d->objectArray.end(); ++it) {
-        if ((*it)->getTypeId().isDerivedFrom(typeId))
-            Objects.push_back(*it);
+    return d->objectsOfType(typeId);
+}
+
+std::vector<DocumentObject*> Document::getObjectsByLabel(const std::string &label) const
+{
+    if (!d->labelIndexValid) {
+        d->labelIndex.clear();
+        d->labelIndex.reserve(d->objectArray.size());
+        for (auto obj : d->objectArray)
+            d->labelIndex.emplace(obj->Label.getStrValue(), obj);
+        d->labelIndexValid = true;
     }
+    std::vector<DocumentObject*> Objects;
+    auto range = d->labelIndex.equal_range(label);
+    for (auto it = range.first; it != range.second; ++it)
+        Objects.push_back(it->second);
+    // Object IDs increase with creation
+    std::sort(Objects.begin(), Objects.end(),
+        [](const DocumentObject *a, const DocumentObject *b) {
+            return a->getID() < b->getID();
+        });
     return Objects;
 }
 
+void Document::_relabelObject(DocumentObject* pcObject)
+{
+    if (!d->labelIndexValid)
+        return;
+    if (!d->eraseLabel(pcObject->getOldLabel(), pcObject))
+        d->clearLabelIndex();
+    else
+        d->labelIndex.emplace(pcObject->Label.getStrValue(), pcObject);
+}
+
 std::vector< DocumentObject* > Document::getObjectsWithExtension(const Base::Type& typeId, bool derived) const {
 
     std::vector<DocumentObject*> Objects;
@@ -5182,33 +5578,21 @@ std::vector<DocumentObject*> Document::findObjects(const Base::Type& typeId, con
         rx_label.set_expression(label);
 
     std::vector<DocumentObject*> Objects;
-    DocumentObject* found = nullptr;
-    for (std::vector<DocumentObject*>::const_iterator it = d->objectArray.begin(); it != d->objectArray.end(); ++it) {
-        if ((*it)->getTypeId().isDerivedFrom(typeId)) {
-            found = *it;
-
-            if (!rx_name.empty() && !boost::regex_search((*it)->getNameInDocument(), what, rx_name))
-                found = nullptr;
+    for (auto obj : d->objectsOfType(typeId)) {
+        if (!rx_name.empty() && !boost::regex_search(obj->getNameInDocument(), what, rx_name))
+            continue;
 
-            if (!rx_label.empty() && !boost::regex_search((*it)->Label.getValue(), what, rx_label))
-                found = nullptr;
+        if (!rx_label.empty() && !boost::regex_search(obj->Label.getValue(), what, rx_label))
+            continue;
 
-            if (found)
-                Objects.push_back(found);
-        }
+        Objects.push_back(obj);
     }
     return Objects;
 }
 
 int Document::countObjectsOfType(const Base::Type& typeId) const
 {
-    int ct=0;
-    for (auto it = d->objectMap.begin(); it != d->objectMap.end(); ++it) {
-        if (it->second->getTypeId().isDerivedFrom(typeId))
-            ct++;
-    }
-
-    return ct;
+    return static_cast<int>(d->objectsOfType(typeId).size());
 }
 
 PyObject * Document::getPyObject(void)
@@ -44,6 +44,7 @@ class QByteArray;
 
 namespace Base {
     class Writer;
+    class Matrix4D;
 }
 
 namespace App
@@ -351,7 +352,15 @@ public:
     std::vector<DocumentObject*> getDependingObjects() const;
     /// Returns a list of all Objects
     const std::vector<DocumentObject*> &getObjects() const;
+    /** Returns all objects derived from the given type in creation order
+     *
+     * The objects are looked up in a per-type index that is built on first
+     * query, and then maintained on object addition and removal, so that
+     * repeated queries cost is proportional to the result size.
+     */
     std::vector<DocumentObject*> getObjectsOfType(const Base::Type& typeId) const;
+    /// Returns all objects with the given label in creation order
+    std::vector<DocumentObject*> getObjectsByLabel(const std::string &label) const;
     /// Returns all object with given extensions. If derived=true also all objects with extensions derived from the given one
     std::vector<DocumentObject*> getObjectsWithExtension(const Base::Type& typeId, bool derived = true) const;
     std::vector<DocumentObject*> findObjects(const Base::Type& typeId, const char* objname, const char* label) const;
@@ -362,6 +371,26 @@ public:
     int countObjects(void) const;
     //@}
 
+    /** @name Sub-object resolution cache
+     *
+     * DocumentObject::getSubObject() stores its results here, keyed by the
+     * queried object, subname and transform flag, with the accumulated
+     * transformation relative to the queried object. Any property change,
+     * object addition or removal in any document invalidates the cache of
+     * all documents, because a subname path may cross document boundaries
+     * through external links.
+     */
+    //@{
+    /// Obtain a cached sub-object. Returns false if there is no valid entry
+    bool getCachedSubObject(const DocumentObject *obj, const char *subname,
+            bool transform, DocumentObject *&ret, Base::Matrix4D &mat) const;
+    /// Cache a resolved sub-object
+    void setCachedSubObject(const DocumentObject *obj, const char *subname,
+            bool transform, DocumentObject *ret, const Base::Matrix4D &mat) const;
+    /// Invalidate the sub-object cache of all documents
+    static void clearSubObjectCache();
+    //@}
+
     /** @name methods for modification and state handling
      */
     //@{
@@ -381,6 +410,14 @@ public:
      *
      * @param objs: specify a sub set of objects to recompute. If empty, then
      * all object in this document is checked for recompute
+     *
+     * The features are executed on the calling thread, so a recompute started
+     * from the GUI blocks it while a feature executes. With CanAbortRecompute
+     * the user may abort between features, and within features that check the
+     * sequencer, the changes are then rolled back if RollbackAbortedRecompute
+     * is on. Running the recompute in a background thread is not supported,
+     * because the document signals are delivered synchronously to observers
+     * that expect to be called on the main thread.
      */
     int recompute(const std::vector<App::DocumentObject*> &objs={},
             bool force=false,bool *hasError=0, int options=0);
@@ -392,6 +429,16 @@ public:
     void setErrorDescription(App::DocumentObject *, const char *);
     /// set the text of the error of a specified object
     void setErrorDescription(App::Property *, const char *);
+    /** Return the executed objects sorted by cost
+     *
+     * @param limit: maximum number of objects to return, 0 for all
+     *
+     * @return Objects with non empty DocumentObject::getRecomputeStats(),
+     * sorted by accumulated execution time in descending order.
+     */
+    std::vector<App::DocumentObject*> getRecomputeReport(std::size_t limit=0) const;
+    /// Reset the recompute statistics of all objects
+    void resetRecomputeStats();
     /// return the status bits
     bool testStatus(Status pos) const;
     /// set the status bits
@@ -448,6 +495,10 @@ public:
     void setUndoLimit(unsigned int UndoMemSize=0);
     /// Returns the actual memory consumption of the Undo redo stuff.
     unsigned int getUndoMemSize (void) const;
+    /** Returns the actual memory consumption of the Undo redo stuff
+     * If given, \a undoSizes receives the size of each undo step, oldest first.
+     */
+    unsigned int getUndoMemSize (std::vector<unsigned int> *undoSizes) const;
     /// Set the Undo limit as stack size
     void setMaxUndoStackSize(unsigned int UndoMaxStackSize=20);
     /// Set the Undo limit as stack size
@@ -617,6 +668,8 @@ protected:
 
     void _removeObject(DocumentObject* pcObject);
     void _addObject(DocumentObject* pcObject, const char* pObjectName);
+    /// Called by DocumentObject to update the label index
+    void _relabelObject(DocumentObject* pcObject);
     /// checks if a valid transaction is open
     void _checkTransaction(DocumentObject* pcDelObj, const Property *What, int line);
     void breakDependency(DocumentObject* pcObject, bool clear);
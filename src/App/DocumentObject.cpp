@@ -823,8 +823,10 @@ void DocumentObject::onChanged(const Property* prop)
     // if (_pDoc)
     //     _pDoc->onChangedProperty(this,prop);
 
-    if (prop == &Label && _pDoc && oldLabel != Label.getStrValue())
+    if (prop == &Label && _pDoc && oldLabel != Label.getStrValue()) {
+        _pDoc->_relabelObject(this);
         _pDoc->signalRelabelObject(*this);
+    }
 
     // set object touched if it is an input property
     if (!testStatus(ObjectStatus::NoTouch) 
@@ -877,6 +879,26 @@ PyObject *DocumentObject::getPyObject(void)
 
 DocumentObject *DocumentObject::getSubObject(const char *subname,
         PyObject **pyObj, Base::Matrix4D *mat, bool transform, int depth) const
+{
+    // Only cache the top level query. Nested calls are part of resolving it,
+    // and the Python object output is not cacheable.
+    if(pyObj || depth || !subname || !subname[0] || !_pDoc || !getNameInDocument()
+             || !DocumentParams::getSubObjectCache())
+        return _getSubObject(subname,pyObj,mat,transform,depth);
+
+    DocumentObject *ret = 0;
+    Base::Matrix4D subMat;
+    if(!_pDoc->getCachedSubObject(this,subname,transform,ret,subMat)) {
+        ret = _getSubObject(subname,0,&subMat,transform,depth);
+        _pDoc->setCachedSubObject(this,subname,transform,ret,subMat);
+    }
+    if(mat)
+        *mat *= subMat;
+    return ret;
+}
+
+DocumentObject *DocumentObject::_getSubObject(const char *subname,
+        PyObject **pyObj, Base::Matrix4D *mat, bool transform, int depth) const
 {
     DocumentObject *ret = 0;
     if(queryExtension(&DocumentObjectExtension::extensionGetSubObject, ret, subname, pyObj, mat, transform, depth))
@@ -91,6 +91,47 @@ public:
     DocumentObject* Which;
 };
 
+/** Accumulated statistics of executing a document object
+ *
+ * Recorded by the document each time the object is actually executed during
+ * recompute. Skipped recomputes are not counted. The memory change is the
+ * difference of the resident set size of the process before and after
+ * execution. It is only recorded if the document parameter
+ * RecomputeMemoryStats is on, and only available on Linux and macOS.
+ */
+struct AppExport RecomputeStats
+{
+    /// Number of executions
+    unsigned long count = 0;
+    /// Execution time in seconds of the last execution
+    double lastTime = 0.0;
+    /// Accumulated execution time in seconds
+    double totalTime = 0.0;
+    /// Maximum execution time in seconds
+    double maxTime = 0.0;
+    /// Memory change in bytes of the last execution
+    long long lastMemory = 0;
+    /// Maximum memory change in bytes
+    long long maxMemory = 0;
+
+    /// Average execution time in seconds
+    double averageTime() const {
+        return count ? totalTime / count : 0.0;
+    }
+
+    /// Record one execution
+    void add(double time, long long memory) {
+        ++count;
+        lastTime = time;
+        totalTime += time;
+        if (time > maxTime)
+            maxTime = time;
+        lastMemory = memory;
+        if (count == 1 || memory > maxMemory)
+            maxMemory = memory;
+    }
+};
+
 
 
 /** Base class of all Classes handled in the Document
@@ -639,6 +680,11 @@ public:
     /// Return a revision number that will change if the object changes.
     virtual int getRevision() const { return _revision; }
 
+    /// Return the accumulated statistics of executing this object
+    const RecomputeStats &getRecomputeStats() const { return _recomputeStats; }
+    /// Reset the statistics of executing this object
+    void resetRecomputeStats() { _recomputeStats = RecomputeStats(); }
+
 protected:
     /** Called when trying to skip recomputing this object
      * @return Return false to force recompute
@@ -716,6 +762,10 @@ protected: // attributes
     const std::string *pcNameInDocument;
 
 private:
+    /// Resolve a sub-object without consulting the document's sub-object cache
+    DocumentObject *_getSubObject(const char *subname, PyObject **pyObj,
+            Base::Matrix4D *mat, bool transform, int depth) const;
+
     // accessed by App::Document to record and restore the correct view provider type
     std::string _pcViewProviderName;
 
@@ -732,6 +782,8 @@ private:
 
     bool _enforceRecompute = false;
     int _revision;
+
+    RecomputeStats _recomputeStats;
 };
 
 } //namespace App
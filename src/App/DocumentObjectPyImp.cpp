@@ -1075,3 +1075,17 @@ Py::Int DocumentObjectPy::getRevision() const
     return Py::Int(getDocumentObjectPtr()->getRevision());
 }
 
+Py::Dict DocumentObjectPy::getRecomputeStats() const
+{
+    const auto &stats = getDocumentObjectPtr()->getRecomputeStats();
+    Py::Dict dict;
+    dict.setItem("count", Py::Long(stats.count));
+    dict.setItem("last", Py::Float(stats.lastTime));
+    dict.setItem("average", Py::Float(stats.averageTime()));
+    dict.setItem("max", Py::Float(stats.maxTime));
+    dict.setItem("total", Py::Float(stats.totalTime));
+    dict.setItem("memory", Py::Long(stats.lastMemory));
+    dict.setItem("maxMemory", Py::Long(stats.maxMemory));
+    return dict;
+}
+
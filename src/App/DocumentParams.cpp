@@ -56,6 +56,7 @@ public:
         signalParamChanged("ForceXML");
         signalParamChanged("SplitXML");
         signalParamChanged("PreferBinary");
+        signalParamChanged("BinaryElementMap");
         signalParamChanged("AutoRemoveFile");
         signalParamChanged("BackupPolicy");
         signalParamChanged("CreateBackupFiles");
@@ -64,6 +65,8 @@ public:
         signalParamChanged("CountBackupFiles");
         signalParamChanged("OptimizeRecompute");
         signalParamChanged("CanAbortRecompute");
+        signalParamChanged("RollbackAbortedRecompute");
+        signalParamChanged("RecomputeMemoryStats");
         signalParamChanged("UseHasher");
         signalParamChanged("ViewObjectTransaction");
         signalParamChanged("WarnRecomputeOnRestore");
@@ -74,6 +77,8 @@ public:
         signalParamChanged("TransactionOnRecompute");
         signalParamChanged("RelativeStringID");
         signalParamChanged("EnableMaterialEdit");
+        signalParamChanged("SubObjectCache");
+        signalParamChanged("SubObjectCacheSize");
 
     // Auto generated code (Tools/params_utils.py:190)
     }
@@ -87,6 +92,7 @@ public:
     long ForceXML;
     bool SplitXML;
     bool PreferBinary;
+    bool BinaryElementMap;
     bool AutoRemoveFile;
     bool BackupPolicy;
     bool CreateBackupFiles;
@@ -95,6 +101,8 @@ public:
     long CountBackupFiles;
     bool OptimizeRecompute;
     bool CanAbortRecompute;
+    bool RollbackAbortedRecompute;
+    bool RecomputeMemoryStats;
     bool UseHasher;
     bool ViewObjectTransaction;
     bool WarnRecomputeOnRestore;
@@ -105,6 +113,8 @@ public:
     bool TransactionOnRecompute;
     bool RelativeStringID;
     bool EnableMaterialEdit;
+    bool SubObjectCache;
+    long SubObjectCacheSize;
 
     // Auto generated code (Tools/params_utils.py:199)
     DocumentParamsP() {
@@ -131,6 +141,8 @@ public:
         funcs["SplitXML"] = &DocumentParamsP::updateSplitXML;
         PreferBinary = handle->GetBool("PreferBinary", false);
         funcs["PreferBinary"] = &DocumentParamsP::updatePreferBinary;
+        BinaryElementMap = handle->GetBool("BinaryElementMap", false);
+        funcs["BinaryElementMap"] = &DocumentParamsP::updateBinaryElementMap;
         AutoRemoveFile = handle->GetBool("AutoRemoveFile", true);
         funcs["AutoRemoveFile"] = &DocumentParamsP::updateAutoRemoveFile;
         BackupPolicy = handle->GetBool("BackupPolicy", true);
@@ -147,6 +159,10 @@ public:
         funcs["OptimizeRecompute"] = &DocumentParamsP::updateOptimizeRecompute;
         CanAbortRecompute = handle->GetBool("CanAbortRecompute", true);
         funcs["CanAbortRecompute"] = &DocumentParamsP::updateCanAbortRecompute;
+        RollbackAbortedRecompute = handle->GetBool("RollbackAbortedRecompute", true);
+        funcs["RollbackAbortedRecompute"] = &DocumentParamsP::updateRollbackAbortedRecompute;
+        RecomputeMemoryStats = handle->GetBool("RecomputeMemoryStats", false);
+        funcs["RecomputeMemoryStats"] = &DocumentParamsP::updateRecomputeMemoryStats;
         UseHasher = handle->GetBool("UseHasher", true);
         funcs["UseHasher"] = &DocumentParamsP::updateUseHasher;
         ViewObjectTransaction = handle->GetBool("ViewObjectTransaction", false);
@@ -167,6 +183,10 @@ public:
         funcs["RelativeStringID"] = &DocumentParamsP::updateRelativeStringID;
         EnableMaterialEdit = handle->GetBool("EnableMaterialEdit", true);
         funcs["EnableMaterialEdit"] = &DocumentParamsP::updateEnableMaterialEdit;
+        SubObjectCache = handle->GetBool("SubObjectCache", true);
+        funcs["SubObjectCache"] = &DocumentParamsP::updateSubObjectCache;
+        SubObjectCacheSize = handle->GetInt("SubObjectCacheSize", 10000);
+        funcs["SubObjectCacheSize"] = &DocumentParamsP::updateSubObjectCacheSize;
     }
 
     // Auto generated code (Tools/params_utils.py:213)
@@ -226,6 +246,10 @@ public:
         self->PreferBinary = self->handle->GetBool("PreferBinary", false);
     }
     // Auto generated code (Tools/params_utils.py:234)
+    static void updateBinaryElementMap(DocumentParamsP *self) {
+        self->BinaryElementMap = self->handle->GetBool("BinaryElementMap", false);
+    }
+    // Auto generated code (Tools/params_utils.py:234)
     static void updateAutoRemoveFile(DocumentParamsP *self) {
         self->AutoRemoveFile = self->handle->GetBool("AutoRemoveFile", true);
     }
@@ -258,6 +282,14 @@ public:
         self->CanAbortRecompute = self->handle->GetBool("CanAbortRecompute", true);
     }
     // Auto generated code (Tools/params_utils.py:234)
+    static void updateRollbackAbortedRecompute(DocumentParamsP *self) {
+        self->RollbackAbortedRecompute = self->handle->GetBool("RollbackAbortedRecompute", true);
+    }
+    // Auto generated code (Tools/params_utils.py:234)
+    static void updateRecomputeMemoryStats(DocumentParamsP *self) {
+        self->RecomputeMemoryStats = self->handle->GetBool("RecomputeMemoryStats", false);
+    }
+    // Auto generated code (Tools/params_utils.py:234)
     static void updateUseHasher(DocumentParamsP *self) {
         self->UseHasher = self->handle->GetBool("UseHasher", true);
     }
@@ -297,6 +329,14 @@ public:
     static void updateEnableMaterialEdit(DocumentParamsP *self) {
         self->EnableMaterialEdit = self->handle->GetBool("EnableMaterialEdit", true);
     }
+    // Auto generated code (Tools/params_utils.py:234)
+    static void updateSubObjectCache(DocumentParamsP *self) {
+        self->SubObjectCache = self->handle->GetBool("SubObjectCache", true);
+    }
+    // Auto generated code (Tools/params_utils.py:234)
+    static void updateSubObjectCacheSize(DocumentParamsP *self) {
+        self->SubObjectCacheSize = self->handle->GetInt("SubObjectCacheSize", 10000);
+    }
 };
 
 // Auto generated code (Tools/params_utils.py:252)
@@ -593,6 +633,33 @@ void DocumentParams::removePreferBinary() {
     instance()->handle->RemoveBool("PreferBinary");
 }
 
+// Auto generated code (Tools/params_utils.py:284)
+const char *DocumentParams::docBinaryElementMap() {
+    return "";
+}
+
+// Auto generated code (Tools/params_utils.py:290)
+const bool & DocumentParams::getBinaryElementMap() {
+    return instance()->BinaryElementMap;
+}
+
+// Auto generated code (Tools/params_utils.py:296)
+const bool & DocumentParams::defaultBinaryElementMap() {
+    const static bool def = false;
+    return def;
+}
+
+// Auto generated code (Tools/params_utils.py:303)
+void DocumentParams::setBinaryElementMap(const bool &v) {
+    instance()->handle->SetBool("BinaryElementMap",v);
+    instance()->BinaryElementMap = v;
+}
+
+// Auto generated code (Tools/params_utils.py:310)
+void DocumentParams::removeBinaryElementMap() {
+    instance()->handle->RemoveBool("BinaryElementMap");
+}
+
 // Auto generated code (Tools/params_utils.py:284)
 const char *DocumentParams::docAutoRemoveFile() {
     return "";
@@ -809,6 +876,60 @@ void DocumentParams::removeCanAbortRecompute() {
     instance()->handle->RemoveBool("CanAbortRecompute");
 }
 
+// Auto generated code (Tools/params_utils.py:284)
+const char *DocumentParams::docRollbackAbortedRecompute() {
+    return "";
+}
+
+// Auto generated code (Tools/params_utils.py:290)
+const bool & DocumentParams::getRollbackAbortedRecompute() {
+    return instance()->RollbackAbortedRecompute;
+}
+
+// Auto generated code (Tools/params_utils.py:296)
+const bool & DocumentParams::defaultRollbackAbortedRecompute() {
+    const static bool def = true;
+    return def;
+}
+
+// Auto generated code (Tools/params_utils.py:303)
+void DocumentParams::setRollbackAbortedRecompute(const bool &v) {
+    instance()->handle->SetBool("RollbackAbortedRecompute",v);
+    instance()->RollbackAbortedRecompute = v;
+}
+
+// Auto generated code (Tools/params_utils.py:310)
+void DocumentParams::removeRollbackAbortedRecompute() {
+    instance()->handle->RemoveBool("RollbackAbortedRecompute");
+}
+
+// Auto generated code (Tools/params_utils.py:284)
+const char *DocumentParams::docRecomputeMemoryStats() {
+    return "";
+}
+
+// Auto generated code (Tools/params_utils.py:290)
+const bool & DocumentParams::getRecomputeMemoryStats() {
+    return instance()->RecomputeMemoryStats;
+}
+
+// Auto generated code (Tools/params_utils.py:296)
+const bool & DocumentParams::defaultRecomputeMemoryStats() {
+    const static bool def = false;
+    return def;
+}
+
+// Auto generated code (Tools/params_utils.py:303)
+void DocumentParams::setRecomputeMemoryStats(const bool &v) {
+    instance()->handle->SetBool("RecomputeMemoryStats",v);
+    instance()->RecomputeMemoryStats = v;
+}
+
+// Auto generated code (Tools/params_utils.py:310)
+void DocumentParams::removeRecomputeMemoryStats() {
+    instance()->handle->RemoveBool("RecomputeMemoryStats");
+}
+
 // Auto generated code (Tools/params_utils.py:284)
 const char *DocumentParams::docUseHasher() {
     return "";
@@ -1078,4 +1199,58 @@ void DocumentParams::setEnableMaterialEdit(const bool &v) {
 void DocumentParams::removeEnableMaterialEdit() {
     instance()->handle->RemoveBool("EnableMaterialEdit");
 }
+
+// Auto generated code (Tools/params_utils.py:284)
+const char *DocumentParams::docSubObjectCache() {
+    return "";
+}
+
+// Auto generated code (Tools/params_utils.py:290)
+const bool & DocumentParams::getSubObjectCache() {
+    return instance()->SubObjectCache;
+}
+
+// Auto generated code (Tools/params_utils.py:296)
+const bool & DocumentParams::defaultSubObjectCache() {
+    const static bool def = true;
+    return def;
+}
+
+// Auto generated code (Tools/params_utils.py:303)
+void DocumentParams::setSubObjectCache(const bool &v) {
+    instance()->handle->SetBool("SubObjectCache",v);
+    instance()->SubObjectCache = v;
+}
+
+// Auto generated code (Tools/params_utils.py:310)
+void DocumentParams::removeSubObjectCache() {
+    instance()->handle->RemoveBool("SubObjectCache");
+}
+
+// Auto generated code (Tools/params_utils.py:284)
+const char *DocumentParams::docSubObjectCacheSize() {
+    return "";
+}
+
+// Auto generated code (Tools/params_utils.py:290)
+const long & DocumentParams::getSubObjectCacheSize() {
+    return instance()->SubObjectCacheSize;
+}
+
+// Auto generated code (Tools/params_utils.py:296)
+const long & DocumentParams::defaultSubObjectCacheSize() {
+    const static long def = 10000;
+    return def;
+}
+
+// Auto generated code (Tools/params_utils.py:303)
+void DocumentParams::setSubObjectCacheSize(const long &v) {
+    instance()->handle->SetInt("SubObjectCacheSize",v);
+    instance()->SubObjectCacheSize = v;
+}
+
+// Auto generated code (Tools/params_utils.py:310)
+void DocumentParams::removeSubObjectCacheSize() {
+    instance()->handle->RemoveInt("SubObjectCacheSize");
+}
 //[[[end]]]
@@ -171,6 +171,16 @@ public:
     static const char *docPreferBinary();
     //@}
 
+    // Auto generated code (Tools/params_utils.py:118)
+    //@{
+    /// Accessor for parameter BinaryElementMap
+    static const bool & getBinaryElementMap();
+    static const bool & defaultBinaryElementMap();
+    static void removeBinaryElementMap();
+    static void setBinaryElementMap(const bool &v);
+    static const char *docBinaryElementMap();
+    //@}
+
     // Auto generated code (Tools/params_utils.py:118)
     //@{
     /// Accessor for parameter AutoRemoveFile
@@ -251,6 +261,26 @@ public:
     static const char *docCanAbortRecompute();
     //@}
 
+    // Auto generated code (Tools/params_utils.py:118)
+    //@{
+    /// Accessor for parameter RollbackAbortedRecompute
+    static const bool & getRollbackAbortedRecompute();
+    static const bool & defaultRollbackAbortedRecompute();
+    static void removeRollbackAbortedRecompute();
+    static void setRollbackAbortedRecompute(const bool &v);
+    static const char *docRollbackAbortedRecompute();
+    //@}
+
+    // Auto generated code (Tools/params_utils.py:118)
+    //@{
+    /// Accessor for parameter RecomputeMemoryStats
+    static const bool & getRecomputeMemoryStats();
+    static const bool & defaultRecomputeMemoryStats();
+    static void removeRecomputeMemoryStats();
+    static void setRecomputeMemoryStats(const bool &v);
+    static const char *docRecomputeMemoryStats();
+    //@}
+
     // Auto generated code (Tools/params_utils.py:118)
     //@{
     /// Accessor for parameter UseHasher
@@ -351,6 +381,26 @@ public:
     static const char *docEnableMaterialEdit();
     //@}
 
+    // Auto generated code (Tools/params_utils.py:118)
+    //@{
+    /// Accessor for parameter SubObjectCache
+    static const bool & getSubObjectCache();
+    static const bool & defaultSubObjectCache();
+    static void removeSubObjectCache();
+    static void setSubObjectCache(const bool &v);
+    static const char *docSubObjectCache();
+    //@}
+
+    // Auto generated code (Tools/params_utils.py:118)
+    //@{
+    /// Accessor for parameter SubObjectCacheSize
+    static const long & getSubObjectCacheSize();
+    static const long & defaultSubObjectCacheSize();
+    static void removeSubObjectCacheSize();
+    static void setSubObjectCacheSize(const long &v);
+    static const char *docSubObjectCacheSize();
+    //@}
+
 // Auto generated code (Tools/params_utils.py:146)
 }; // class DocumentParams
 } // namespace App
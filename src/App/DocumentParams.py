@@ -47,6 +47,7 @@ Params = [
     ParamInt('ForceXML', 3),
     ParamBool('SplitXML', True),
     ParamBool('PreferBinary', False),
+    ParamBool('BinaryElementMap', False),
     ParamBool('AutoRemoveFile', True),
     ParamBool('BackupPolicy', True),
     ParamBool('CreateBackupFiles', True),
@@ -55,6 +56,8 @@ Params = [
     ParamInt('CountBackupFiles', 1),
     ParamBool('OptimizeRecompute', True),
     ParamBool('CanAbortRecompute', True),
+    ParamBool('RollbackAbortedRecompute', True),
+    ParamBool('RecomputeMemoryStats', False),
     ParamBool('UseHasher', True),
     ParamBool('ViewObjectTransaction', False),
     ParamBool('WarnRecomputeOnRestore', True),
@@ -65,6 +68,8 @@ Params = [
     ParamBool('TransactionOnRecompute', False),
     ParamBool('RelativeStringID', True),
     ParamBool('EnableMaterialEdit', True),
+    ParamBool('SubObjectCache', True),
+    ParamInt('SubObjectCacheSize', 10000),
 ]
 
 def declare():
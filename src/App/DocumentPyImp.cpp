@@ -545,12 +545,8 @@ PyObject*  DocumentPy::getObjectsByLabel(PyObject *args)
         return NULL;                             // NULL triggers exception
 
     Py::List list;
-    std::string name = sName;
-    std::vector<DocumentObject*> objs = getDocumentPtr()->getObjects();
-    for (std::vector<DocumentObject*>::iterator it = objs.begin(); it != objs.end(); ++it) {
-        if (name == (*it)->Label.getValue())
-            list.append(Py::asObject((*it)->getPyObject()));
-    }
+    for (auto obj : getDocumentPtr()->getObjectsByLabel(sName))
+        list.append(Py::asObject(obj->getPyObject()));
 
     return Py::new_reference_to(list);
 }
@@ -857,6 +853,31 @@ PyObject *DocumentPy::getDependentDocuments(PyObject *args) {
     } PY_CATCH;
 }
 
+PyObject *DocumentPy::getRecomputeReport(PyObject *args)
+{
+    int limit = 0;
+    if (!PyArg_ParseTuple(args, "|i", &limit))
+        return nullptr;
+    PY_TRY {
+        Py::List ret;
+        for (auto obj : getDocumentPtr()->getRecomputeReport(std::max(limit, 0))) {
+            Py::Object pyObj(obj->getPyObject(), true);
+            ret.append(Py::TupleN(pyObj, pyObj.getAttr("RecomputeStats")));
+        }
+        return Py::new_reference_to(ret);
+    } PY_CATCH;
+}
+
+PyObject *DocumentPy::resetRecomputeStats(PyObject *args)
+{
+    if (!PyArg_ParseTuple(args, ""))
+        return nullptr;
+    PY_TRY {
+        getDocumentPtr()->resetRecomputeStats();
+        Py_Return;
+    } PY_CATCH;
+}
+
 PyObject* DocumentPy::reorderObjects(PyObject *args)
 {
     PyObject *pyobj;
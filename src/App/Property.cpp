@@ -264,6 +264,9 @@ void Property::touch()
 
     PropertyCleaner guard(this);
     _StatusBits.set(Touched);
+    // Any change may affect sub-object resolution, including changes
+    // applied by undo/redo, which are not notified below.
+    Document::clearSubObjectCache();
     if (getName() && father
                   && !Transaction::isApplying(this)
                   && !Document::isRemoving(this)) {
@@ -129,6 +129,15 @@ public:
         return sizeof(father) + sizeof(StatusBits);
     }
 
+    /** Returns the address of data that Copy() shares instead of duplicating
+     * Properties holding large data, e.g. a mesh or a shape, may return a copy
+     * referencing the same data. The undo/redo memory accounting then uses
+     * the returned address to count it only once. The default returns null.
+     */
+    virtual const void *getSharedData() const {
+        return nullptr;
+    }
+
     /** Get the name of this property in the belonging container
      * With \ref hasName() it can be checked beforehand if a valid name is set.
      * @note If no name is set this function returns an empty string, i.e. "".
@@ -114,7 +114,25 @@ int Transaction::getLastID() {
 
 unsigned int Transaction::getMemSize (void) const
 {
-    return 0;
+    std::set<const void*> shared;
+    return getMemSize(shared);
+}
+
+unsigned int Transaction::getMemSize (std::set<const void*> &shared) const
+{
+    if (!memSizeValid) {
+        memSize = 0;
+        sharedSizes.clear();
+        for (auto &v : _Objects)
+            memSize += v.second->getMemSize(sharedSizes);
+        memSizeValid = true;
+    }
+    unsigned int size = memSize;
+    for (auto &v : sharedSizes) {
+        if (shared.insert(v.first).second)
+            size += v.second;
+    }
+    return size;
 }
 
 void Transaction::Save (Base::Writer &/*writer*/) const
@@ -145,6 +163,7 @@ bool Transaction::hasObject(const TransactionalObject *Obj) const
 void Transaction::addOrRemoveProperty(TransactionalObject *Obj,
                                     const Property* pcProp, bool add)
 {
+    memSizeValid = false;
     auto &index = _Objects.get<1>();
     auto pos = index.find(Obj);
 
@@ -360,6 +379,7 @@ void Transaction::apply(Document &Doc, bool forward)
 
 void Transaction::addObjectNew(TransactionalObject *Obj)
 {
+    memSizeValid = false;
     auto &index = _Objects.get<1>();
     auto pos = index.find(Obj);
     if (pos != index.end()) {
@@ -387,6 +407,7 @@ void Transaction::addObjectNew(TransactionalObject *Obj)
 
 void Transaction::addObjectDel(const TransactionalObject *Obj)
 {
+    memSizeValid = false;
     auto &index = _Objects.get<1>();
     auto pos = index.find(Obj);
 
@@ -408,6 +429,7 @@ void Transaction::addObjectDel(const TransactionalObject *Obj)
 
 void Transaction::addObjectChange(const TransactionalObject *Obj, const Property *Prop)
 {
+    memSizeValid = false;
     auto &index = _Objects.get<1>();
     auto pos = index.find(Obj);
 
@@ -586,7 +608,30 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
 
 unsigned int TransactionObject::getMemSize (void) const
 {
-    return 0;
+    std::vector<std::pair<const void*, unsigned int> > sharedSizes;
+    unsigned int size = getMemSize(sharedSizes);
+    std::set<const void*> shared;
+    for (auto &v : sharedSizes) {
+        if (shared.insert(v.first).second)
+            size += v.second;
+    }
+    return size;
+}
+
+unsigned int TransactionObject::getMemSize (std::vector<std::pair<const void*, unsigned int> > &shared) const
+{
+    unsigned int size = 0;
+    for (auto &v : _PropChangeMap) {
+        const Property *prop = v.second.property;
+        if (!prop)
+            continue;
+        const void *data = prop->getSharedData();
+        if (data)
+            shared.emplace_back(data, prop->getMemSize());
+        else
+            size += prop->getMemSize();
+    }
+    return size;
 }
 
 void TransactionObject::Save (Base::Writer &/*writer*/) const
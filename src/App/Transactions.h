@@ -25,7 +25,9 @@
 #ifndef APP_TRANSACTION_H
 #define APP_TRANSACTION_H
 
+#include <set>
 #include <unordered_map>
+#include <vector>
 #include <Base/Factory.h>
 #include <Base/Persistence.h>
 #include <App/PropertyContainer.h>
@@ -65,7 +67,18 @@ public:
     // the utf-8 name of the transaction
     std::string Name;
 
+    /** Returns the memory retained by this transaction
+     * Data shared between property copies is only counted once, see
+     * Property::getSharedData(). The size is cached until the transaction
+     * changes again.
+     */
     virtual unsigned int getMemSize (void) const;
+    /** Returns the memory retained by this transaction, except for the shared
+     * data already listed in \a shared
+     * The shared data of this transaction is added to \a shared, so that data
+     * shared by several transactions is counted only once.
+     */
+    unsigned int getMemSize (std::set<const void*> &shared) const;
     virtual void Save (Base::Writer &writer) const;
     /// This method is used to restore properties from an XML document.
     virtual void Restore(Base::XMLReader &reader);
@@ -94,6 +107,11 @@ public:
 
 private:
     int transID;
+    /// cached size of the data that is not shared
+    mutable unsigned int memSize = 0;
+    /// cached address and size of the shared data
+    mutable std::vector<std::pair<const void*, unsigned int> > sharedSizes;
+    mutable bool memSizeValid = false;
     typedef std::pair<const TransactionalObject*, TransactionObject*> Info;
     bmi::multi_index_container<
         Info,
@@ -126,6 +144,8 @@ public:
     void addOrRemoveProperty(const Property* pcProp, bool add);
 
     virtual unsigned int getMemSize (void) const;
+    /// Returns the size of the data that is not shared and lists the shared data in \a shared
+    unsigned int getMemSize (std::vector<std::pair<const void*, unsigned int> > &shared) const;
     virtual void Save (Base::Writer &writer) const;
     /// This method is used to restore properties from an XML document.
     virtual void Restore(Base::XMLReader &reader);
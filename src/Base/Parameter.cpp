@@ -673,14 +673,16 @@ ParameterGrp::GetAttribute(ParamType Type,
     if (!T)
         return Default;
 
-    DOMElement *pcElem = FindElement(_pGroupNode,T,Name);
-    if (!pcElem)
-        return Default;
+    if (Type == FCGroup) {
+        if (!FindElement(_pGroupNode,T,Name))
+            return Default;
+        return Value.c_str();
+    }
 
-    if (Type == FCText)
-        Value = GetASCII(Name, Default);
-    else if (Type != FCGroup)
-        Value = StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str();
+    ParamValue v;
+    if (!_GetCachedValue(Type, Name, v, true))
+        return Default;
+    Value = std::move(v.text);
     return Value.c_str();
 }
 
@@ -742,6 +744,8 @@ void ParameterGrp::_SetAttribute(ParamType T, const char *Name, const char *Valu
     // find or create the Element
     DOMElement *pcElem = FindOrCreateElement(_pGroupNode,Type,Name);
     if (pcElem) {
+        // the element may have just been created, so update regardless
+        _UpdateCache(T, Name, Value);
         XStr attr("Value");
         // set the value only if different
         if (strcmp(StrX(pcElem->getAttribute(attr.unicodeForm())).c_str(),Value)!=0) {
@@ -757,18 +761,10 @@ void ParameterGrp::_SetAttribute(ParamType T, const char *Name, const char *Valu
 
 bool ParameterGrp::GetBool(const char* Name, bool bPreset) const
 {
-    if (!_pGroupNode)
+    ParamValue Value;
+    if (!_GetCachedValue(FCBool, Name, Value))
         return bPreset;
-
-    // check if Element in group
-    DOMElement *pcElem = FindElement(_pGroupNode,"FCBool",Name);
-    // if not return preset
-    if (!pcElem) return bPreset;
-    // if yes check the value and return
-    if (strcmp(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str(),"1"))
-        return false;
-    else
-        return true;
+    return Value.value.bValue;
 }
 
 void  ParameterGrp::SetBool(const char* Name, bool bValue)
@@ -828,15 +824,10 @@ std::vector<std::pair<std::string,bool> > ParameterGrp::GetBoolMap(const char *
 
 long ParameterGrp::GetInt(const char* Name, long lPreset) const
 {
-    if (!_pGroupNode)
+    ParamValue Value;
+    if (!_GetCachedValue(FCInt, Name, Value))
         return lPreset;
-
-    // check if Element in group
-    DOMElement *pcElem = FindElement(_pGroupNode,"FCInt",Name);
-    // if not return preset
-    if (!pcElem) return lPreset;
-    // if yes check the value and return
-    return atol (StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str());
+    return Value.value.lValue;
 }
 
 void  ParameterGrp::SetInt(const char* Name, long lValue)
@@ -893,15 +884,10 @@ std::vector<std::pair<std::string,long> > ParameterGrp::GetIntMap(const char * s
 
 unsigned long ParameterGrp::GetUnsigned(const char* Name, unsigned long lPreset) const
 {
-    if (!_pGroupNode)
+    ParamValue Value;
+    if (!_GetCachedValue(FCUInt, Name, Value))
         return lPreset;
-
-    // check if Element in group
-    DOMElement *pcElem = FindElement(_pGroupNode,"FCUInt",Name);
-    // if not return preset
-    if (!pcElem) return lPreset;
-    // if yes check the value and return
-    return strtoul (StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str(),0,10);
+    return Value.value.uValue;
 }
 
 void  ParameterGrp::SetUnsigned(const char* Name, unsigned long lValue)
@@ -958,15 +944,10 @@ std::vector<std::pair<std::string,unsigned long> > ParameterGrp::GetUnsignedMap(
 
 double ParameterGrp::GetFloat(const char* Name, double dPreset) const
 {
-    if (!_pGroupNode)
+    ParamValue Value;
+    if (!_GetCachedValue(FCFloat, Name, Value))
         return dPreset;
-
-    // check if Element in group
-    DOMElement *pcElem = FindElement(_pGroupNode,"FCFloat",Name);
-    // if not return preset
-    if (!pcElem) return dPreset;
-    // if yes check the value and return
-    return atof (StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str());
+    return Value.value.fValue;
 }
 
 void  ParameterGrp::SetFloat(const char* Name, double dValue)
@@ -1063,11 +1044,13 @@ void  ParameterGrp::SetASCII(const char* Name, const char *sValue)
             XERCES_CPP_NAMESPACE_QUALIFIER DOMDocument *pDocument = _pGroupNode->getOwnerDocument();
             DOMText *pText = pDocument->createTextNode(XUTF8Str(sValue).unicodeForm());
             pcElem->appendChild(pText);
+            _UpdateCache(FCText, Name, sValue);
             if (isNew  || sValue[0]!=0)
                 _Notify(FCText, Name, sValue);
         }
         else if (strcmp(StrXUTF8(pcElem2->getNodeValue()).c_str(), sValue)!=0) {
             pcElem2->setNodeValue(XUTF8Str(sValue).unicodeForm());
+            _UpdateCache(FCText, Name, sValue);
             _Notify(FCText, Name, sValue);
         }
         // trigger observer
@@ -1077,24 +1060,10 @@ void  ParameterGrp::SetASCII(const char* Name, const char *sValue)
 
 std::string ParameterGrp::GetASCII(const char* Name, const char * pPreset) const
 {
-    if (!_pGroupNode)
+    ParamValue Value;
+    if (!_GetCachedValue(FCText, Name, Value))
         return pPreset ? pPreset : "";
-
-    // check if Element in group
-    DOMElement *pcElem = FindElement(_pGroupNode,"FCText",Name);
-    // if not return preset
-    if (!pcElem) {
-        if (pPreset==0)
-            return std::string("");
-        else
-            return std::string(pPreset);
-    }
-    // if yes check the value and return
-    DOMNode *pcElem2 = pcElem->getFirstChild();
-    if (pcElem2)
-        return std::string(StrXUTF8(pcElem2->getNodeValue()).c_str());
-    else
-        return std::string("");
+    return std::move(Value.text);
 }
 
 std::vector<std::string> ParameterGrp::GetASCIIs(const char * sFilter) const
@@ -1167,6 +1136,7 @@ void ParameterGrp::RemoveASCII(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _InvalidateCache();
 
     // trigger observer
     _Notify(FCText, Name, nullptr);
@@ -1186,6 +1156,7 @@ void ParameterGrp::RemoveBool(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _InvalidateCache();
 
     // trigger observer
     _Notify(FCBool, Name, nullptr);
@@ -1218,6 +1189,7 @@ void ParameterGrp::RemoveFloat(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _InvalidateCache();
 
     // trigger observer
     _Notify(FCFloat,Name, nullptr);
@@ -1237,6 +1209,7 @@ void ParameterGrp::RemoveInt(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _InvalidateCache();
 
     // trigger observer
     _Notify(FCInt, Name, nullptr);
@@ -1256,6 +1229,7 @@ void ParameterGrp::RemoveUnsigned(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _InvalidateCache();
 
     // trigger observer
     _Notify(FCUInt, Name, nullptr);
@@ -1360,6 +1334,7 @@ void ParameterGrp::Clear(bool notify)
         DOMNode *node = _pGroupNode->removeChild(child);
         node->release();
     }
+    _InvalidateCache();
 
     for (auto &v : params) {
         _Notify(v.first, v.second.c_str(), nullptr);
@@ -1455,6 +1430,97 @@ XERCES_CPP_NAMESPACE_QUALIFIER DOMNode *ParameterGrp::FindAttribute(XERCES_CPP_N
     return nullptr;
 }
 
+void ParameterGrp::_ParseValue(ParamType Type, const char *Text, ParamValue &Value)
+{
+    Value.text = Text;
+    switch (Type) {
+    case FCBool:
+        Value.value.bValue = strcmp(Text, "1") == 0;
+        break;
+    case FCInt:
+        Value.value.lValue = atol(Text);
+        break;
+    case FCUInt:
+        Value.value.uValue = strtoul(Text, 0, 10);
+        break;
+    case FCFloat:
+        Value.value.fValue = atof(Text);
+        break;
+    default:
+        break;
+    }
+}
+
+void ParameterGrp::_BuildCache() const
+{
+    for (auto &map : _Cache)
+        map.clear();
+    _CacheValid = true;
+    if (!_pGroupNode)
+        return;
+
+    XStr attr("Value");
+    for (DOMNode *clChild = _pGroupNode->getFirstChild();
+            clChild != 0;  clChild = clChild->getNextSibling()) {
+        if (clChild->getNodeType() != DOMNode::ELEMENT_NODE)
+            continue;
+        ParamType Type = TypeValue(StrX(clChild->getNodeName()).c_str());
+        if (Type == FCInvalid || Type == FCGroup)
+            continue;
+        DOMNode *name = FindAttribute(clChild, "Name");
+        if (!name)
+            continue;
+        // Keep the first one in case of duplicates, same as FindElement()
+        auto res = _Cache[Type].emplace(StrX(name->getNodeValue()).c_str(), ParamValue());
+        if (!res.second)
+            continue;
+        if (Type == FCText) {
+            DOMNode *text = clChild->getFirstChild();
+            if (text)
+                res.first->second.text = StrXUTF8(text->getNodeValue()).c_str();
+        }
+        else {
+            _ParseValue(Type, StrX(static_cast<DOMElement*>(
+                            clChild)->getAttribute(attr.unicodeForm())).c_str(),
+                        res.first->second);
+        }
+    }
+}
+
+bool ParameterGrp::_GetCachedValue(ParamType Type, const char *Name,
+                                   ParamValue &Value, bool copyText) const
+{
+    if (!Name)
+        return false;
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    if (!_CacheValid)
+        _BuildCache();
+    const auto &map = _Cache[Type];
+    auto it = map.find(Name);
+    if (it == map.end())
+        return false;
+    if (Type == FCText || copyText)
+        Value = it->second;
+    else
+        Value.value = it->second.value;
+    return true;
+}
+
+void ParameterGrp::_UpdateCache(ParamType Type, const char *Name, const char *Value)
+{
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    if (_CacheValid)
+        _ParseValue(Type, Value, _Cache[Type][Name]);
+}
+
+void ParameterGrp::_InvalidateCache()
+{
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    _CacheValid = false;
+    for (auto &map : _Cache)
+        map.clear();
+}
+
 std::vector<std::pair<ParameterGrp::ParamType,std::string> >
 ParameterGrp::GetParameterNames(const char * sFilter) const
 {
@@ -1513,6 +1579,7 @@ void ParameterGrp::NotifyAll()
 void ParameterGrp::_Reset()
 {
     _pGroupNode = nullptr;
+    _InvalidateCache();
     for (auto &v : _GroupMap)
         v.second->_Reset();
 }
@@ -1802,6 +1869,7 @@ int ParameterManager::LoadDocument(const XERCES_CPP_NAMESPACE_QUALIFIER InputSou
         throw XMLBaseException("Malformed Parameter document: Root group not found");
 
     _pGroupNode = FindElement(rootElem,"FCParamGroup","Root");
+    _InvalidateCache();
 
     if (!_pGroupNode)
         throw XMLBaseException("Malformed Parameter document: Root group not found");
@@ -1983,6 +2051,7 @@ void  ParameterManager::CreateDocument(void)
     _pGroupNode = _pDocument->createElement(XStr("FCParamGroup").unicodeForm());
     static_cast<DOMElement*>(_pGroupNode)->setAttribute(XStr("Name").unicodeForm(), XStr("Root").unicodeForm());
     rootElem->appendChild(_pGroupNode);
+    _InvalidateCache();
 }
 
 void  ParameterManager::CheckDocument() const
@@ -58,6 +58,8 @@
 #endif
 
 #include <map>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 #include <boost_signals2.hpp>
 #include <xercesc/util/XercesDefs.hpp>
@@ -320,6 +322,42 @@ protected:
      */
     XERCES_CPP_NAMESPACE_QUALIFIER DOMNode *FindAttribute(XERCES_CPP_NAMESPACE_QUALIFIER DOMNode *Node, const char* Name) const;
 
+    /// Native copy of a parameter value
+    struct ParamValue {
+        /// the value as stored in the xml element
+        std::string text;
+        union {
+            bool bValue;
+            long lValue;
+            unsigned long uValue;
+            double fValue;
+        } value;
+    };
+
+    /** Look up a parameter value in the native cache of this group
+     *
+     *  The cache is built from the DOM on first access and then serves all
+     *  single value reads, so that they neither scan the children of the
+     *  group node nor transcode any xml string. The setters keep the cache in
+     *  sync, while any other modification of the DOM content invalidates it.
+     *  The DOM remains the persistent storage used for saving and exporting.
+     *
+     *  @param Type: parameter type
+     *  @param Name: parameter name
+     *  @param Value: output the value if found. The text is only copied for
+     *  FCText, or if \a copyText is true.
+     *  @param copyText: whether to copy the text of non string values
+     *  @return Returns true if the parameter exists
+     */
+    bool _GetCachedValue(ParamType Type, const char *Name,
+                         ParamValue &Value, bool copyText=false) const;
+    /// Update the cached value after setting it in the DOM
+    void _UpdateCache(ParamType Type, const char *Name, const char *Value);
+    /// Discard the cached values, they are rebuilt on next access
+    void _InvalidateCache();
+    void _BuildCache() const;
+    static void _ParseValue(ParamType Type, const char *Text, ParamValue &Value);
+
     /// DOM Node of the Base node of this group
     XERCES_CPP_NAMESPACE_QUALIFIER DOMElement *_pGroupNode;
     /// the own name
@@ -335,6 +373,11 @@ protected:
      * This is used to prevent anynew value/sub-group to be added in observer
      */
     bool _Clearing = false;
+
+    /// Cached parameter values indexed by type, see _GetCachedValue()
+    mutable std::unordered_map<std::string, ParamValue> _Cache[FCGroup];
+    mutable bool _CacheValid = false;
+    mutable std::mutex _CacheMutex;
 };
 
 /** The parameter serializer class
@@ -0,0 +1,236 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <chrono>
+# include <mutex>
+# include <ostream>
+# include <vector>
+#endif
+
+#include "Profiler.h"
+#include "Exception.h"
+#include "FileInfo.h"
+#include "Stream.h"
+
+using namespace Base;
+
+namespace {
+
+struct ProfileEvent
+{
+    const char *name;
+    const char *category;
+    std::string detail;
+    int64_t start;
+    int64_t duration;
+    double value;
+    bool counter;
+};
+
+void writeJsonString(std::ostream &os, const char *s)
+{
+    static const char hex[] = "0123456789abcdef";
+    os << '"';
+    for (; *s; ++s) {
+        unsigned char c = static_cast<unsigned char>(*s);
+        switch (c) {
+        case '"':
+            os << "\\\"";
+            break;
+        case '\\':
+            os << "\\\\";
+            break;
+        case '\n':
+            os << "\\n";
+            break;
+        case '\t':
+            os << "\\t";
+            break;
+        default:
+            if (c < 0x20)
+                os << "\\u00" << hex[c >> 4] << hex[c & 0xf];
+            else
+                os << *s;
+        }
+    }
+    os << '"';
+}
+
+} // anonymous namespace
+
+struct Profiler::ThreadBuffer
+{
+    int tid;
+    std::mutex mutex;
+    std::vector<ProfileEvent> events;
+};
+
+struct Profiler::Private
+{
+    mutable std::mutex mutex;
+    // Buffers are shared with the thread_local pointer of their thread, so
+    // that a buffer survives its thread until exported.
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    int nextTid = 1;
+};
+
+std::atomic<bool> Profiler::_capturing(false);
+
+Profiler::Profiler()
+    : d(new Private)
+{
+}
+
+Profiler::~Profiler()
+{
+}
+
+Profiler &Profiler::instance()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+int64_t Profiler::now()
+{
+    static const auto epoch = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - epoch).count();
+}
+
+Profiler::ThreadBuffer &Profiler::threadBuffer()
+{
+    static thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (!buffer) {
+        buffer = std::make_shared<ThreadBuffer>();
+        std::lock_guard<std::mutex> lock(d->mutex);
+        buffer->tid = d->nextTid++;
+        d->buffers.push_back(buffer);
+    }
+    return *buffer;
+}
+
+void Profiler::start()
+{
+    clear();
+    _capturing = true;
+}
+
+void Profiler::stop()
+{
+    _capturing = false;
+}
+
+void Profiler::clear()
+{
+    std::lock_guard<std::mutex> lock(d->mutex);
+    for (auto it = d->buffers.begin(); it != d->buffers.end();) {
+        // Drop the buffers of finished threads
+        if (it->use_count() == 1) {
+            it = d->buffers.erase(it);
+            continue;
+        }
+        std::lock_guard<std::mutex> bufferLock((*it)->mutex);
+        (*it)->events.clear();
+        ++it;
+    }
+}
+
+std::size_t Profiler::eventCount() const
+{
+    std::size_t count = 0;
+    std::lock_guard<std::mutex> lock(d->mutex);
+    for (auto &buffer : d->buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        count += buffer->events.size();
+    }
+    return count;
+}
+
+void Profiler::addZone(const char *name, const char *category,
+                       std::string &&detail, int64_t start, int64_t end)
+{
+    if (!isCapturing())
+        return;
+    auto &buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.events.push_back({name, category, std::move(detail),
+                             start, end - start, 0.0, false});
+}
+
+void Profiler::addCounter(const char *name, double value)
+{
+    if (!isCapturing())
+        return;
+    auto &buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.events.push_back({name, "counter", std::string(),
+                             now(), 0, value, true});
+}
+
+void Profiler::exportTrace(std::ostream &os) const
+{
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    std::lock_guard<std::mutex> lock(d->mutex);
+    for (auto &buffer : d->buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        for (auto &event : buffer->events) {
+            if (!first)
+                os << ",";
+            first = false;
+            os << "\n{\"name\":";
+            writeJsonString(os, event.name);
+            os << ",\"cat\":";
+            writeJsonString(os, event.category);
+            os << ",\"pid\":1,\"tid\":" << buffer->tid
+               << ",\"ts\":" << event.start;
+            if (event.counter) {
+                os << ",\"ph\":\"C\",\"args\":{";
+                writeJsonString(os, event.name);
+                os << ":" << event.value << "}}";
+                continue;
+            }
+            os << ",\"ph\":\"X\",\"dur\":" << event.duration;
+            if (!event.detail.empty()) {
+                os << ",\"args\":{\"detail\":";
+                writeJsonString(os, event.detail.c_str());
+                os << "}";
+            }
+            os << "}";
+        }
+    }
+    os << "\n]}\n";
+}
+
+void Profiler::exportTrace(const char *filename) const
+{
+    Base::FileInfo fi(filename);
+    Base::ofstream str(fi, std::ios::out | std::ios::binary);
+    if (!str)
+        throw Base::FileException("Cannot open file for writing", fi);
+    exportTrace(str);
+}
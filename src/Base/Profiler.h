@@ -0,0 +1,196 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef BASE_PROFILER_H
+#define BASE_PROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+
+namespace Base
+{
+
+/** Hierarchical profiler with Chrome trace-event export
+ *
+ * Code is instrumented with scoped zones (see ProfileZone and the
+ * FC_PROFILE_ZONE macros) and counters (see FC_PROFILE_COUNTER). While no
+ * capture is running, a zone costs a single relaxed atomic load. During
+ * capture, each thread appends to its own event buffer, so that zones
+ * recorded in worker threads do not contend with each other.
+ *
+ * Zones of the same thread nest by time. The exported trace can be loaded
+ * into chrome://tracing or https://ui.perfetto.dev to inspect the hierarchy.
+ *
+ * Example usage,
+ * @code
+ *     void Foo::execute() {
+ *         FC_PROFILE_ZONE_DETAIL("Foo::execute", "App", getFullName());
+ *         ...
+ *         FC_PROFILE_COUNTER("Foo::count", count);
+ *     }
+ * @endcode
+ *
+ * From Python,
+ * @code
+ *     FreeCAD.startProfiler()
+ *     doc.recompute()
+ *     FreeCAD.stopProfiler("/tmp/recompute.json")
+ * @endcode
+ */
+class BaseExport Profiler
+{
+public:
+    /// Return the profiler singleton
+    static Profiler &instance();
+
+    /// Start capturing. Any previously captured events are discarded
+    void start();
+    /// Stop capturing. The captured events are kept until next start() or clear()
+    void stop();
+    /// Check if capture is running
+    static bool isCapturing() {
+        return _capturing.load(std::memory_order_relaxed);
+    }
+    /// Discard all captured events
+    void clear();
+    /// Return the number of captured events
+    std::size_t eventCount() const;
+
+    /// Write the captured events in Chrome trace-event JSON format
+    void exportTrace(std::ostream &) const;
+    /** Write the captured events in Chrome trace-event JSON format
+     * @param filename: output file name
+     * @throw Base::FileException if the file cannot be opened
+     */
+    void exportTrace(const char *filename) const;
+
+    /** Record a finished zone of the calling thread
+     * @param name: zone name. Must be a string with static life time.
+     * @param category: zone category. Must be a string with static life time.
+     * @param detail: optional detail, e.g. the name of the object involved
+     * @param start: start time stamp obtained by now()
+     * @param end: end time stamp obtained by now()
+     */
+    void addZone(const char *name, const char *category,
+                 std::string &&detail, int64_t start, int64_t end);
+    /** Record a counter value
+     * @param name: counter name. Must be a string with static life time.
+     * @param value: counter value
+     */
+    void addCounter(const char *name, double value);
+
+    /// Time stamp in micro seconds used by the profiler
+    static int64_t now();
+
+private:
+    Profiler();
+    ~Profiler();
+
+    struct ThreadBuffer;
+    ThreadBuffer &threadBuffer();
+
+private:
+    static std::atomic<bool> _capturing;
+    struct Private;
+    std::unique_ptr<Private> d;
+};
+
+/// Scoped profiling zone, see Profiler
+class BaseExport ProfileZone
+{
+public:
+    /** Constructor
+     * @param name: zone name. Must be a string with static life time.
+     * @param category: zone category. Must be a string with static life time.
+     */
+    ProfileZone(const char *name, const char *category)
+    {
+        if (Profiler::isCapturing()) {
+            _name = name;
+            _category = category;
+            _start = Profiler::now();
+        }
+    }
+
+    ~ProfileZone()
+    {
+        if (_name)
+            Profiler::instance().addZone(_name, _category,
+                    std::move(_detail), _start, Profiler::now());
+    }
+
+    /// Check if this zone is being recorded
+    bool isActive() const {
+        return _name != nullptr;
+    }
+
+    /// Set an optional detail of this zone
+    void setDetail(const std::string &detail) {
+        _detail = detail;
+    }
+    /// Set an optional detail of this zone
+    void setDetail(const char *detail) {
+        if (detail)
+            _detail = detail;
+    }
+
+private:
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone &operator=(const ProfileZone&) = delete;
+
+private:
+    const char *_name = nullptr;
+    const char *_category = nullptr;
+    int64_t _start = 0;
+    std::string _detail;
+};
+
+} // namespace Base
+
+#define _FC_PROFILE_CAT2(_a, _b) _a##_b
+#define _FC_PROFILE_CAT(_a, _b) _FC_PROFILE_CAT2(_a, _b)
+#define _FC_PROFILE_VAR _FC_PROFILE_CAT(_fc_profile_zone_, __LINE__)
+
+/// Profile the rest of the current scope
+#define FC_PROFILE_ZONE(_name, _category) \
+    Base::ProfileZone _FC_PROFILE_VAR(_name, _category)
+
+/** Profile the rest of the current scope with some detail
+ * The expression \c _detail is only evaluated while capturing.
+ */
+#define FC_PROFILE_ZONE_DETAIL(_name, _category, _detail) \
+    Base::ProfileZone _FC_PROFILE_VAR(_name, _category);\
+    if (_FC_PROFILE_VAR.isActive()) _FC_PROFILE_VAR.setDetail(_detail)
+
+/** Record a counter value
+ * The expression \c _value is only evaluated while capturing.
+ */
+#define FC_PROFILE_COUNTER(_name, _value) do {\
+    if (Base::Profiler::isCapturing())\
+        Base::Profiler::instance().addCounter(_name, _value);\
+} while(0)
+
+#endif // BASE_PROFILER_H
@@ -0,0 +1,170 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <cstring>
+#endif
+
+#include <CXX/Objects.hxx>
+
+#include "PyBuffer.h"
+#include "Exception.h"
+
+using namespace Base;
+
+PyObject *Base::newArrayBuffer(const char *format, std::size_t itemSize,
+                               std::size_t rows, std::size_t cols, void **data)
+{
+    Py_ssize_t size = static_cast<Py_ssize_t>(rows * cols * itemSize);
+    Py::Object bytes(PyByteArray_FromStringAndSize(nullptr, size), true);
+    if (bytes.isNull())
+        throw Py::Exception();
+    *data = PyByteArray_AS_STRING(bytes.ptr());
+
+    Py::Object view(PyMemoryView_FromObject(bytes.ptr()), true);
+    if (view.isNull())
+        throw Py::Exception();
+
+    PyObject *res;
+    if (size)
+        res = PyObject_CallMethod(view.ptr(), "cast", "s(nn)", format,
+                static_cast<Py_ssize_t>(rows), static_cast<Py_ssize_t>(cols));
+    else
+        res = PyObject_CallMethod(view.ptr(), "cast", "s", format);
+    if (!res)
+        throw Py::Exception();
+    return res;
+}
+
+namespace {
+
+class BufferGuard
+{
+public:
+    explicit BufferGuard(PyObject *obj)
+    {
+        if (!PyObject_CheckBuffer(obj))
+            throw Base::TypeError("Expect an object supporting the buffer protocol");
+        if (PyObject_GetBuffer(obj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+            PyErr_Clear();
+            throw Base::TypeError("Expect a C contiguous buffer");
+        }
+    }
+
+    ~BufferGuard()
+    {
+        PyBuffer_Release(&view);
+    }
+
+    Py_buffer view;
+};
+
+// Return the struct module item type of a native buffer, or 0 if not supported
+char itemType(const Py_buffer &view)
+{
+    const char *format = view.format ? view.format : "B";
+    if (*format == '@' || *format == '=')
+        ++format;
+    if (!format[0] || format[1])
+        return 0;
+    return format[0];
+}
+
+template<typename T, typename S>
+void copyItems(const Py_buffer &view, std::vector<T> &values, bool checkSign)
+{
+    std::size_t count = static_cast<std::size_t>(view.len) / sizeof(S);
+    auto items = static_cast<const S*>(view.buf);
+    values.resize(count);
+    for (std::size_t i=0; i<count; ++i) {
+        if (checkSign && items[i] < 0)
+            throw Base::ValueError("Expect non-negative indices");
+        values[i] = static_cast<T>(items[i]);
+    }
+}
+
+template<typename T>
+void readItems(PyObject *obj, std::size_t cols, std::vector<T> &values, bool integerOnly)
+{
+    BufferGuard guard(obj);
+    const Py_buffer &view = guard.view;
+    if (view.itemsize <= 0 || view.len % view.itemsize)
+        throw Base::TypeError("Invalid buffer item size");
+    std::size_t count = static_cast<std::size_t>(view.len / view.itemsize);
+    if (cols && count % cols)
+        throw Base::ValueError("Buffer size is not a multiple of the number of columns");
+
+    bool sign = integerOnly;
+    switch (itemType(view)) {
+#define FC_BUFFER_ITEM(_c, _t, _signed) \
+    case _c:\
+        if (view.itemsize == sizeof(_t)) {\
+            copyItems<T, _t>(view, values, sign && _signed);\
+            return;\
+        }\
+        break
+    FC_BUFFER_ITEM('b', signed char, true);
+    FC_BUFFER_ITEM('B', unsigned char, false);
+    FC_BUFFER_ITEM('h', short, true);
+    FC_BUFFER_ITEM('H', unsigned short, false);
+    FC_BUFFER_ITEM('i', int, true);
+    FC_BUFFER_ITEM('I', unsigned int, false);
+    FC_BUFFER_ITEM('l', long, true);
+    FC_BUFFER_ITEM('L', unsigned long, false);
+    FC_BUFFER_ITEM('q', long long, true);
+    FC_BUFFER_ITEM('Q', unsigned long long, false);
+    FC_BUFFER_ITEM('n', Py_ssize_t, true);
+    FC_BUFFER_ITEM('N', size_t, false);
+#undef FC_BUFFER_ITEM
+    case 'f':
+        if (!integerOnly && view.itemsize == sizeof(float)) {
+            copyItems<T, float>(view, values, false);
+            return;
+        }
+        break;
+    case 'd':
+        if (!integerOnly && view.itemsize == sizeof(double)) {
+            copyItems<T, double>(view, values, false);
+            return;
+        }
+        break;
+    default:
+        break;
+    }
+    throw Base::TypeError(integerOnly ? "Expect a buffer of native integers"
+                                      : "Expect a buffer of native integers or floats");
+}
+
+} // anonymous namespace
+
+void Base::readArrayBuffer(PyObject *obj, std::size_t cols, std::vector<double> &values)
+{
+    readItems(obj, cols, values, false);
+}
+
+void Base::readArrayBuffer(PyObject *obj, std::size_t cols, std::vector<unsigned long> &values)
+{
+    readItems(obj, cols, values, true);
+}
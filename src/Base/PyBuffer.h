@@ -0,0 +1,106 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef BASE_PYBUFFER_H
+#define BASE_PYBUFFER_H
+
+// Python stuff
+#include <Python.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Base
+{
+
+/** Helpers to exchange bulk numeric arrays with Python
+ *
+ * Arrays are passed as typed memoryview objects of shape (rows, cols), which
+ * numpy wraps without copying, e.g.
+ * @code
+ *     points, facets = mesh.getTopologyArrays()
+ *     pts = numpy.asarray(points)   # float32 array of shape (N, 3)
+ * @endcode
+ *
+ * In the other direction, any C contiguous object supporting the buffer
+ * protocol with an integer or floating point item type is accepted, e.g.
+ * numpy arrays, array.array or memoryview.
+ */
+//@{
+
+/** Create a memoryview of shape (rows, cols) over a new writable buffer
+ *
+ * @param format: item format as used by the struct module, e.g. "f"
+ * @param itemSize: size of an item in bytes
+ * @param rows, cols: shape of the view
+ * @param data: receives the address of the buffer for the caller to fill in
+ *
+ * @return New reference. An empty array is returned as a one dimensional
+ * view, because memoryview cannot represent zeros in shape.
+ * @throw Py::Exception on Python error
+ */
+BaseExport PyObject *newArrayBuffer(const char *format, std::size_t itemSize,
+                                    std::size_t rows, std::size_t cols, void **data);
+
+/// Typed version of newArrayBuffer() for float, double and std::uint32_t
+template<typename T>
+PyObject *newArrayBuffer(std::size_t rows, std::size_t cols, T **data);
+
+template<>
+inline PyObject *newArrayBuffer(std::size_t rows, std::size_t cols, float **data) {
+    return newArrayBuffer("f", sizeof(float), rows, cols, reinterpret_cast<void**>(data));
+}
+template<>
+inline PyObject *newArrayBuffer(std::size_t rows, std::size_t cols, double **data) {
+    return newArrayBuffer("d", sizeof(double), rows, cols, reinterpret_cast<void**>(data));
+}
+template<>
+inline PyObject *newArrayBuffer(std::size_t rows, std::size_t cols, std::uint32_t **data) {
+    return newArrayBuffer("I", sizeof(std::uint32_t), rows, cols, reinterpret_cast<void**>(data));
+}
+
+/** Copy a numeric buffer into a vector of double
+ *
+ * @param obj: object supporting the buffer protocol with an integer or
+ * floating point item type
+ * @param cols: number of columns, the item count must be a multiple of it
+ * @param values: receives the items in row major order
+ *
+ * @throw Base::TypeError if obj is not a suitable buffer
+ * @throw Base::ValueError if the item count does not fit the columns
+ */
+BaseExport void readArrayBuffer(PyObject *obj, std::size_t cols, std::vector<double> &values);
+
+/** Copy an integer buffer into a vector of indices
+ *
+ * Same as above, except that only integer item types are accepted, and
+ * negative values raise Base::ValueError.
+ */
+BaseExport void readArrayBuffer(PyObject *obj, std::size_t cols, std::vector<unsigned long> &values);
+
+//@}
+
+} // namespace Base
+
+#endif // BASE_PYBUFFER_H
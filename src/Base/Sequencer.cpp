@@ -36,6 +36,7 @@
 
 #include "Sequencer.h"
 #include "Console.h"
+#include "Exception.h"
 #include <CXX/Objects.hxx>
 
 using namespace Base;
@@ -150,8 +151,11 @@ bool SequencerBase::next(bool canAbort)
     return this->nProgress < this->nTotalSteps;
 }
 
-void SequencerBase::nextStep( bool )
+void SequencerBase::nextStep( bool canAbort )
 {
+    // there is no user interface to confirm a cancel request, so abort right away
+    if (canAbort && wasCanceled())
+        throw Base::AbortException("User aborted");
 }
 
 void SequencerBase::setProgress(size_t)
@@ -258,10 +262,11 @@ void ConsoleSequencer::startStep()
 {
 }
 
-void ConsoleSequencer::nextStep( bool )
+void ConsoleSequencer::nextStep( bool canAbort )
 {
     if (this->nTotalSteps != 0)
         printf("\t\t\t\t\t\t(%2.1f %%)\t\r", (float)progressInPercent());
+    SequencerBase::nextStep(canAbort);
 }
 
 void ConsoleSequencer::resetData()
@@ -356,6 +361,8 @@ void ProgressIndicatorPy::init_type()
     add_varargs_method("start",&ProgressIndicatorPy::start,"start(string,int)");
     add_varargs_method("next",&ProgressIndicatorPy::next,"next()");
     add_varargs_method("stop",&ProgressIndicatorPy::stop,"stop()");
+    add_varargs_method("cancel",&ProgressIndicatorPy::cancel,
+        "cancel() -- request to abort the pending operation, like pressing the ESC key");
 }
 
 PyObject *ProgressIndicatorPy::PyMake(struct _typeobject *, PyObject *, PyObject *)
@@ -413,3 +420,11 @@ Py::Object ProgressIndicatorPy::stop(const Py::Tuple& args)
     return Py::None();
 }
 
+Py::Object ProgressIndicatorPy::cancel(const Py::Tuple& args)
+{
+    if (!PyArg_ParseTuple(args.ptr(), ""))
+        throw Py::Exception();
+    SequencerBase::Instance().tryToCancel();
+    return Py::None();
+}
+
@@ -220,9 +220,10 @@ protected:
     virtual void startStep();
     /**
      * This method can be reimplemented in sub-classes to give the user a feedback
-     * when the next is performed. The default implementation does nothing. If \a canAbort
-     * is true then the pending operation can aborted, otherwise not. Depending on the
-     * re-implementation this method can throw an AbortException if canAbort is true.
+     * when the next is performed. If \a canAbort is true then the pending operation can
+     * aborted, otherwise not. Depending on the re-implementation this method can throw an
+     * AbortException if canAbort is true. The default implementation throws it if a cancel
+     * was requested with tryToCancel().
      */
     virtual void nextStep(bool canAbort);
     /**
@@ -399,6 +400,7 @@ public:
     Py::Object start(const Py::Tuple&);
     Py::Object next(const Py::Tuple&);
     Py::Object stop(const Py::Tuple&);
+    Py::Object cancel(const Py::Tuple&);
 
 private:
     static PyObject *PyMake(struct _typeobject *, PyObject *, PyObject *);
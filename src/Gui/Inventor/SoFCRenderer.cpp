@@ -88,6 +88,7 @@
 #include <Inventor/SbRotation.h>
 
 #include <Base/Console.h>
+#include <Base/Profiler.h>
 #include "SoFCRenderer.h"
 #include "SoFCRenderCache.h"
 #include "SoFCVertexCache.h"
@@ -1999,6 +2000,7 @@ SoFCRendererP::renderTransparency(SoGLRenderAction * action,
 void
 SoFCRenderer::render(SoGLRenderAction * action)
 {
+  FC_PROFILE_ZONE("SoFCRenderer::render", "Gui");
   SoState * state = action->getState();
 
   const SoShapeStyleElement * shapestyle = SoShapeStyleElement::get(state);
@@ -4103,6 +4103,18 @@ void TreeWidget::onToolTipTimer()
             } catch (Base::Exception &) {
             }
         }
+        const auto &stats = Obj->getRecomputeStats();
+        if (stats.count) {
+            typeName += tr("\nRecompute: last %1 s, average %2 s, max %3 s, count %4")
+                .arg(stats.lastTime, 0, 'f', 3)
+                .arg(stats.averageTime(), 0, 'f', 3)
+                .arg(stats.maxTime, 0, 'f', 3)
+                .arg(stats.count);
+            if (stats.lastMemory)
+                typeName += tr("\nRecompute memory: last %1 KB, max %2 KB")
+                    .arg(stats.lastMemory / 1024)
+                    .arg(stats.maxMemory / 1024);
+        }
     }
 
     QString label = QString::fromUtf8(Obj->Label.getValue());
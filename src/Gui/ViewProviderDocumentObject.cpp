@@ -48,6 +48,7 @@
 #include <Base/Console.h>
 #include <Base/Tools.h>
 #include <Base/BoundBox.h>
+#include <Base/Profiler.h>
 #include <App/Material.h>
 #include <App/DocumentObjectGroup.h>
 #include <App/DocumentObserver.h>
@@ -484,6 +485,8 @@ void ViewProviderDocumentObject::update(const App::Property* prop)
     if (prop == &getObject()->ViewObject)
         return;
 
+    FC_PROFILE_ZONE_DETAIL("ViewProvider::update", "Gui", prop->getFullName());
+
     // bypass view provider update to always allow changing visibility from
     // document object
     if(prop == &getObject()->Visibility) {
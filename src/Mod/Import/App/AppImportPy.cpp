@@ -118,7 +118,10 @@ public:
             "export(list,string) -- Export a list of objects into a single file."
         );
          add_keyword_method("readDXF",&Module::readDXF,
-            "readDXF(filename,[document,ignore_errors]): Imports a DXF file into the given document. ignore_errors is True by default."
+            "readDXF(filename,[document,ignore_errors,option_source,recompute,group_layers]): Imports a DXF file into the given document.\n"
+            "ignore_errors is True by default. If group_layers is given, it overrides the\n"
+            "'groupLayers' option and creates one compound object per layer instead of\n"
+            "one object per entity."
         );
         add_varargs_method("writeDXFShape",&Module::writeDXFShape,
             "writeDXFShape([shape],filename [version,usePolyline,optionSource]): Exports Shape(s) to a DXF file."
@@ -297,9 +300,10 @@ private:
         PyObject *exportHidden = Py_None;
         PyObject *legacy = Py_None;
         PyObject *keepPlacement = Py_None;
-        static char* kwd_list[] = {"obj", "name", "exportHidden", "legacy", "keepPlacement",0};
-        if(!PyArg_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "Oet|OOO",
-                    kwd_list,&object,"utf-8",&Name,&exportHidden,&legacy,&keepPlacement))
+        PyObject *shareGeometry = Py_None;
+        static char* kwd_list[] = {"obj", "name", "exportHidden", "legacy", "keepPlacement", "shareGeometry",0};
+        if(!PyArg_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "Oet|OOOO",
+                    kwd_list,&object,"utf-8",&Name,&exportHidden,&legacy,&keepPlacement,&shareGeometry))
             throw Py::Exception();
 
         std::string Utf8Name = std::string(Name);
@@ -331,6 +335,8 @@ private:
                     ocaf.setExportHiddenObject(PyObject_IsTrue(exportHidden));
                 if(keepPlacement!=Py_None)
                     ocaf.setKeepPlacement(PyObject_IsTrue(keepPlacement));
+                if(shareGeometry!=Py_None)
+                    ocaf.setShareGeometry(PyObject_IsTrue(shareGeometry));
                 ocaf.exportObjects(objs);
             }
             else {
@@ -419,10 +425,11 @@ private:
         bool doRecompute = true;
         std::string defaultOptions = "User parameter:BaseApp/Preferences/Mod/Draft";
         bool IgnoreErrors=true;
+        PyObject *groupLayers = Py_None;
         static char* kwd_list[] = {"filename","document","ignore_errors",
-                                   "option_source","recompute",nullptr};
-        if(!PyArg_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "et|sbsb", kwd_list,
-                    "utf-8",&Name,&DocName,&IgnoreErrors,&optionSource,&doRecompute))
+                                   "option_source","recompute","group_layers",nullptr};
+        if(!PyArg_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "et|sbsbO", kwd_list,
+                    "utf-8",&Name,&DocName,&IgnoreErrors,&optionSource,&doRecompute,&groupLayers))
             throw Py::Exception();
 
         std::string EncodedName = std::string(Name);
@@ -448,6 +455,8 @@ private:
             ImpExpDxfRead dxf_file(EncodedName,pcDoc);
             dxf_file.setOptionSource(defaultOptions);
             dxf_file.setOptions();
+            if (groupLayers != Py_None)
+                dxf_file.setGroupLayers(PyObject_IsTrue(groupLayers) ? true : false);
             dxf_file.DoRead(IgnoreErrors);
             if (doRecompute)
                 pcDoc->recompute();
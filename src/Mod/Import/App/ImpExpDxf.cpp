@@ -60,6 +60,7 @@
 #endif
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <QtConcurrentMap>
 
 #include <Base/Console.h>
 #include <Base/Parameter.h>
@@ -87,6 +88,21 @@ ImpExpDxfRead::ImpExpDxfRead(std::string filepath, App::Document *pcDoc) : CDxfR
     setOptions();
 }
 
+ImpExpDxfRead::~ImpExpDxfRead()
+{
+    // DoRead() may have been left with an exception while a batch was
+    // still being converted
+    conversion.waitForFinished();
+}
+
+void ImpExpDxfRead::DoRead(const bool ignore_errors)
+{
+    CDxfRead::DoRead(ignore_errors);
+    // CDxfRead::DoRead() may return early on read errors without calling
+    // AddGraphics(), add whatever has been parsed up to that point
+    syncEntities();
+}
+
 void ImpExpDxfRead::setOptions(void)
 {
     ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(getOptionSource().c_str());
@@ -94,6 +110,8 @@ void ImpExpDxfRead::setOptions(void)
     optionGroupLayers = hGrp->GetBool("groupLayers",false);
     optionImportAnnotations = hGrp->GetBool("dxftext",false);
     optionScaling = hGrp->GetFloat("dxfScaling",1.0);
+    optionParallel = hGrp->GetBool("dxfParallelImport",true);
+    optionBatchSize = std::max<long>(1,hGrp->GetInt("dxfBatchSize",4096));
 }
 
 gp_Pnt ImpExpDxfRead::makePoint(const double* p)
@@ -111,56 +129,41 @@ gp_Pnt ImpExpDxfRead::makePoint(const double* p)
 
 void ImpExpDxfRead::OnReadLine(const double* s, const double* e, bool /*hidden*/)
 {
-    gp_Pnt p0 = makePoint(s);
-    gp_Pnt p1 = makePoint(e);
-    if (p0.IsEqual(p1,0.00000001))
+    DxfEntity entity(DxfEntity::Line, LayerName());
+    entity.pnt[0] = makePoint(s);
+    entity.pnt[1] = makePoint(e);
+    if (entity.pnt[0].IsEqual(entity.pnt[1],0.00000001))
         return;
-    BRepBuilderAPI_MakeEdge makeEdge(p0, p1);
-    AddObject(makeEdge.Edge());
+    queueEntity(std::move(entity));
 }
 
 
 void ImpExpDxfRead::OnReadPoint(const double* s)
 {
-    BRepBuilderAPI_MakeVertex makeVertex(makePoint(s));
-    AddObject(makeVertex.Vertex());
+    DxfEntity entity(DxfEntity::Point, LayerName());
+    entity.pnt[0] = makePoint(s);
+    queueEntity(std::move(entity));
 }
 
 
 void ImpExpDxfRead::OnReadArc(const double* s, const double* e, const double* c, bool dir, bool /*hidden*/)
 {
-    gp_Pnt p0 = makePoint(s);
-    gp_Pnt p1 = makePoint(e);
-    gp_Dir up(0, 0, 1);
-    if (!dir)
-        up = -up;
-    gp_Pnt pc = makePoint(c);
-    gp_Circ circle(gp_Ax2(pc, up), p0.Distance(pc));
-    if (circle.Radius() > 0) {
-        BRepBuilderAPI_MakeEdge makeEdge(circle, p0, p1);
-        AddObject(makeEdge.Edge());
-    }
-    else {
-        Base::Console().Warning("ImpExpDxf - ignore degenerate arc of circle\n");
-    }
+    DxfEntity entity(DxfEntity::Arc, LayerName());
+    entity.pnt[0] = makePoint(s);
+    entity.pnt[1] = makePoint(e);
+    entity.pnt[2] = makePoint(c);
+    entity.dir = dir;
+    queueEntity(std::move(entity));
 }
 
 
 void ImpExpDxfRead::OnReadCircle(const double* s, const double* c, bool dir, bool /*hidden*/)
 {
-    gp_Pnt p0 = makePoint(s);
-    gp_Dir up(0, 0, 1);
-    if (!dir)
-        up = -up;
-    gp_Pnt pc = makePoint(c);
-    gp_Circ circle(gp_Ax2(pc, up), p0.Distance(pc));
-    if (circle.Radius() > 0) {
-        BRepBuilderAPI_MakeEdge makeEdge(circle);
-        AddObject(makeEdge.Edge());
-    }
-    else {
-        Base::Console().Warning("ImpExpDxf - ignore degenerate circle\n");
-    }
+    DxfEntity entity(DxfEntity::Circle, LayerName());
+    entity.pnt[0] = makePoint(s);
+    entity.pnt[2] = makePoint(c);
+    entity.dir = dir;
+    queueEntity(std::move(entity));
 }
 
 
@@ -256,50 +259,170 @@ Handle(Geom_BSplineCurve) getInterpolationSpline(struct SplineData& sd)
 
 void ImpExpDxfRead::OnReadSpline(struct SplineData& sd)
 {
-    // https://documentation.help/AutoCAD-DXF/WS1a9193826455f5ff18cb41610ec0a2e719-79e1.htm
-    // Flags:
-    // 1: Closed, 2: Periodic, 4: Rational, 8: Planar, 16: Linear
+    DxfEntity entity(DxfEntity::Spline, LayerName());
+    entity.spline = std::make_shared<SplineData>(sd);
+    queueEntity(std::move(entity));
+}
 
-    try {
-        Handle(Geom_BSplineCurve) geom;
-        if (sd.control_points > 0)
-            geom = getSplineFromPolesAndKnots(sd);
-        else if (sd.fit_points > 0)
-            geom = getInterpolationSpline(sd);
 
-        if (geom.IsNull())
-            throw Standard_Failure();
+void ImpExpDxfRead::OnReadEllipse(const double* c, double major_radius, double minor_radius, double rotation, double start_angle, double end_angle, bool dir)
+{
+    DxfEntity entity(DxfEntity::Ellipse, LayerName());
+    entity.pnt[2] = makePoint(c);
+    entity.values[0] = major_radius * optionScaling;
+    entity.values[1] = minor_radius * optionScaling;
+    entity.values[2] = rotation;
+    entity.values[3] = start_angle;
+    entity.values[4] = end_angle;
+    entity.dir = dir;
+    queueEntity(std::move(entity));
+}
+
 
-        BRepBuilderAPI_MakeEdge makeEdge(geom);
-        AddObject(makeEdge.Edge());
+void ImpExpDxfRead::buildEntity(DxfEntity &entity)
+{
+    // Runs on a worker thread, so only touch the entity itself. Warnings are
+    // reported by commitEntities() on the main thread.
+    try {
+        switch (entity.type) {
+        case DxfEntity::Line: {
+            BRepBuilderAPI_MakeEdge makeEdge(entity.pnt[0], entity.pnt[1]);
+            entity.shape = makeEdge.Edge();
+            break;
+        }
+        case DxfEntity::Point: {
+            BRepBuilderAPI_MakeVertex makeVertex(entity.pnt[0]);
+            entity.shape = makeVertex.Vertex();
+            break;
+        }
+        case DxfEntity::Arc:
+        case DxfEntity::Circle: {
+            gp_Dir up(0, 0, 1);
+            if (!entity.dir)
+                up = -up;
+            const gp_Pnt &p0 = entity.pnt[0];
+            const gp_Pnt &pc = entity.pnt[2];
+            gp_Circ circle(gp_Ax2(pc, up), p0.Distance(pc));
+            if (circle.Radius() <= 0) {
+                entity.warning = entity.type == DxfEntity::Arc ?
+                    "ImpExpDxf - ignore degenerate arc of circle\n" :
+                    "ImpExpDxf - ignore degenerate circle\n";
+            }
+            else if (entity.type == DxfEntity::Arc) {
+                BRepBuilderAPI_MakeEdge makeEdge(circle, p0, entity.pnt[1]);
+                entity.shape = makeEdge.Edge();
+            }
+            else {
+                BRepBuilderAPI_MakeEdge makeEdge(circle);
+                entity.shape = makeEdge.Edge();
+            }
+            break;
+        }
+        case DxfEntity::Ellipse: {
+            gp_Dir up(0, 0, 1);
+            if (!entity.dir)
+                up = -up;
+            const gp_Pnt &pc = entity.pnt[2];
+            gp_Elips ellipse(gp_Ax2(pc, up), entity.values[0], entity.values[1]);
+            if (ellipse.MinorRadius() > 0) {
+                BRepBuilderAPI_MakeEdge makeEdge(ellipse, entity.values[3], entity.values[4]);
+                TopoDS_Edge edge = makeEdge.Edge();
+                gp_Trsf trsf;
+                trsf.SetRotation(gp_Ax1(pc,up),entity.values[2]);
+                edge.Location(trsf);
+                entity.shape = edge;
+            }
+            else {
+                entity.warning = "ImpExpDxf - ignore degenerate ellipse\n";
+            }
+            break;
+        }
+        case DxfEntity::Spline: {
+            // https://documentation.help/AutoCAD-DXF/WS1a9193826455f5ff18cb41610ec0a2e719-79e1.htm
+            // Flags:
+            // 1: Closed, 2: Periodic, 4: Rational, 8: Planar, 16: Linear
+            SplineData &sd = *entity.spline;
+            Handle(Geom_BSplineCurve) geom;
+            if (sd.control_points > 0)
+                geom = getSplineFromPolesAndKnots(sd);
+            else if (sd.fit_points > 0)
+                geom = getInterpolationSpline(sd);
+
+            if (geom.IsNull())
+                throw Standard_Failure();
+
+            BRepBuilderAPI_MakeEdge makeEdge(geom);
+            entity.shape = makeEdge.Edge();
+            break;
+        }
+        case DxfEntity::PolyLineBreak:
+            break;
+        }
     }
     catch (const Standard_Failure&) {
-        Base::Console().Warning("ImpExpDxf - failed to create bspline\n");
+        entity.shape.Nullify();
+        entity.warning = entity.type == DxfEntity::Spline ?
+            "ImpExpDxf - failed to create bspline\n" :
+            "ImpExpDxf - failed to create edge\n";
     }
+    // The spline data is no longer needed, release it early for large files
+    entity.spline.reset();
 }
 
 
-void ImpExpDxfRead::OnReadEllipse(const double* c, double major_radius, double minor_radius, double rotation, double start_angle, double end_angle, bool dir)
+void ImpExpDxfRead::queueEntity(DxfEntity &&entity)
+{
+    pendingEntities.push_back(std::move(entity));
+    if (pendingEntities.size() >= optionBatchSize)
+        dispatchEntities();
+}
+
+
+void ImpExpDxfRead::dispatchEntities()
 {
-    gp_Dir up(0, 0, 1);
-    if(!dir)
-        up = -up;
-    gp_Pnt pc = makePoint(c);
-    gp_Elips ellipse(gp_Ax2(pc, up), major_radius * optionScaling, minor_radius * optionScaling);
-    if (ellipse.MinorRadius() > 0) {
-        BRepBuilderAPI_MakeEdge makeEdge(ellipse, start_angle, end_angle);
-        TopoDS_Edge edge = makeEdge.Edge();
-        gp_Trsf trsf;
-        trsf.SetRotation(gp_Ax1(pc,up),rotation);
-        edge.Location(trsf);
-        AddObject(edge);
+    // Keep at most one batch in flight: the next batch is parsed while the
+    // previous one is converted
+    commitEntities();
+    if (pendingEntities.empty())
+        return;
+    convertingEntities.swap(pendingEntities);
+    if (optionParallel && convertingEntities.size() > 1) {
+        conversion = QtConcurrent::map(convertingEntities, &ImpExpDxfRead::buildEntity);
     }
     else {
-        Base::Console().Warning("ImpExpDxf - ignore degenerate ellipse\n");
+        for (auto &entity : convertingEntities)
+            buildEntity(entity);
     }
 }
 
 
+void ImpExpDxfRead::commitEntities()
+{
+    conversion.waitForFinished();
+    conversion = QFuture<void>();
+    for (auto &entity : convertingEntities) {
+        if (entity.warning)
+            Base::Console().Warning("%s", entity.warning);
+        if (entity.type == DxfEntity::PolyLineBreak) {
+            auto it = layers.find(entity.layer);
+            if (it != layers.end())
+                it->second.flushPolyLine();
+        }
+        else if (!entity.shape.IsNull()) {
+            AddObject(entity.shape, entity.layer);
+        }
+    }
+    convertingEntities.clear();
+}
+
+
+void ImpExpDxfRead::syncEntities()
+{
+    dispatchEntities();
+    commitEntities();
+}
+
+
 void ImpExpDxfRead::OnReadText(const double *point, const double /*height*/, const char* text)
 {
     if (optionImportAnnotations) {
@@ -320,6 +443,8 @@ void ImpExpDxfRead::OnReadInsert(const double* point, const double* scale, const
     std::string prefix = "BLOCKS ";
     prefix += name;
     prefix += " ";
+    // the block geometry must be complete before it can be inserted
+    syncEntities();
     for(auto &v : layers) {
         if (boost::starts_with(v.first, prefix)) {
             v.second.flushPolyLine();
@@ -348,8 +473,14 @@ void ImpExpDxfRead::OnReadDimension(const double* s, const double* e, const doub
 
 void ImpExpDxfRead::AddObject(const TopoDS_Shape &shape)
 {
-    //std::cout << "layer:" << LayerName() << std::endl;
-    auto &info = layers[LayerName()];
+    AddObject(shape, LayerName());
+}
+
+
+void ImpExpDxfRead::AddObject(const TopoDS_Shape &shape, const std::string &layer)
+{
+    //std::cout << "layer:" << layer << std::endl;
+    auto &info = layers[layer];
     Part::TopoShape s(shape);
     s.Tag = -1; // To skip topo naming processing
     if (shape.ShapeType() == TopAbs_EDGE)
@@ -357,7 +488,7 @@ void ImpExpDxfRead::AddObject(const TopoDS_Shape &shape)
     else
         info.shapes.push_back(s);
     if (!optionGroupLayers) {
-        if(LayerName().substr(0, 6) != "BLOCKS") {
+        if(layer.substr(0, 6) != "BLOCKS") {
             Part::Feature *pcFeature = (Part::Feature *)document->addObject("Part::Feature", "Shape");
             pcFeature->Shape.setValue(shape);
         }
@@ -406,12 +537,28 @@ std::string ImpExpDxfRead::Deformat(const char* text)
 
 void ImpExpDxfRead::AddGraphics()
 {
+    syncEntities();
     if (optionGroupLayers) {
+        // Wire connection and compound building of the layers are
+        // independent of each other, so do them concurrently. Only the
+        // document objects are created on the main thread.
+        std::vector<std::pair<const std::string*, LayerInfo*>> groups;
         for (auto &v : layers) {
-            if (boost::starts_with(v.first, "BLOCKS"))
-                continue;
-            v.second.flushPolyLine();
-            const char *name = v.first.c_str();
+            if (!boost::starts_with(v.first, "BLOCKS"))
+                groups.emplace_back(&v.first, &v.second);
+        }
+        auto build = [](std::pair<const std::string*, LayerInfo*> &group) {
+            LayerInfo &info = *group.second;
+            info.flushPolyLine();
+            info.compound = Part::TopoShape().makECompound(info.shapes, "", false);
+        };
+        if (optionParallel)
+            QtConcurrent::blockingMap(groups, build);
+        else
+            std::for_each(groups.begin(), groups.end(), build);
+
+        for (auto &v : groups) {
+            const char *name = v.first->c_str();
             std::string _name;
             if (std::isdigit((int)name[0])) {
                 _name = "LAYER_";
@@ -419,7 +566,7 @@ void ImpExpDxfRead::AddGraphics()
                 name = _name.c_str();
             }
             Part::Feature *pcFeature = (Part::Feature *)document->addObject("Part::Feature", name);
-            pcFeature->Shape.setValue(Part::TopoShape().makECompound(v.second.shapes, "", false));
+            pcFeature->Shape.setValue(v.second->compound);
         }
     }
 }
@@ -428,9 +575,8 @@ void ImpExpDxfRead::OnPolyLineStart()
 {
     if (!optionConnectEdges)
         return;
-    auto it = layers.find(LayerName());
-    if (it != layers.end())
-        it->second.flushPolyLine();
+    // queued so that the edges parsed so far end up in the previous wire
+    queueEntity(DxfEntity(DxfEntity::PolyLineBreak, LayerName()));
 }
 
 void ImpExpDxfRead::LayerInfo::flushPolyLine()
@@ -27,6 +27,8 @@
 #include <Mod/Part/App/TopoShape.h>
 #include <App/Document.h>
 #include <gp_Pnt.hxx>
+#include <memory>
+#include <QFuture>
 
 class BRepAdaptor_Curve;
 
@@ -36,6 +38,10 @@ namespace Import
     {
     public:
         ImpExpDxfRead(std::string filepath, App::Document *pcDoc);
+        ~ImpExpDxfRead();
+
+        /// Reads the file and makes sure all queued entities are added
+        void DoRead(const bool ignore_errors = false);
     
         // CDxfRead's virtual functions
         void OnReadLine(const double* s, const double* e, bool hidden);
@@ -52,24 +58,71 @@ namespace Import
     
         // FreeCAD-specific functions
         void AddObject(const TopoDS_Shape &shape); //Called by OnRead functions to add Part objects
+        void AddObject(const TopoDS_Shape &shape, const std::string &layer);
         std::string Deformat(const char* text); // Removes DXF formatting from texts
 
         std::string getOptionSource() { return m_optionSource; }
         void setOptionSource(std::string s) { m_optionSource = s; }
         void setOptions(void);
 
+        /// Create one compound feature per layer instead of one feature per entity
+        void setGroupLayers(bool enable) { optionGroupLayers = enable; }
+        /// Convert parsed entities to OCC geometry on worker threads
+        void setParallelConversion(bool enable) { optionParallel = enable; }
+
     private:
         gp_Pnt makePoint(const double* p);
-        
+
+        /** Parsed entity waiting for conversion to OCC geometry
+         *
+         * The reader only records the (already scaled) entity parameters
+         * while parsing. The edges are built in batches by buildEntity(),
+         * possibly on worker threads, and handed to AddObject() in the
+         * original file order by commitEntities().
+         */
+        struct DxfEntity {
+            enum Type {
+                Line,
+                Point,
+                Arc,
+                Circle,
+                Ellipse,
+                Spline,
+                PolyLineBreak, // marks the start of a new polyline in its layer
+            };
+            Type type;
+            std::string layer;
+            gp_Pnt pnt[3];
+            double values[5] = {0.0, 0.0, 0.0, 0.0, 0.0};
+            bool dir = true;
+            std::shared_ptr<SplineData> spline;
+            TopoDS_Shape shape;
+            const char *warning = nullptr;
+
+            DxfEntity(Type t, const std::string &l) : type(t), layer(l) {}
+        };
+        static void buildEntity(DxfEntity &entity);
+        void queueEntity(DxfEntity &&entity);
+        void dispatchEntities();
+        void commitEntities();
+        void syncEntities();
+
+        std::vector<DxfEntity> pendingEntities;
+        std::vector<DxfEntity> convertingEntities;
+        QFuture<void> conversion;
+
     protected:
         App::Document *document;
         bool optionGroupLayers;
         bool optionImportAnnotations;
         bool optionConnectEdges;
+        bool optionParallel;
+        std::size_t optionBatchSize;
         double optionScaling;
         struct LayerInfo {
             std::vector<Part::TopoShape> shapes;
             std::vector<Part::TopoShape> edges;
+            Part::TopoShape compound;
             void flushPolyLine();
         };
         std::map <std::string, LayerInfo> layers;
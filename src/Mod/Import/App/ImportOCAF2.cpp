@@ -44,14 +44,25 @@
 # include <TopoDS_Iterator.hxx>
 # include <Interface_Static.hxx>
 # include <TDF_AttributeSequence.hxx>
+# include <TopExp.hxx>
+# include <TopoDS.hxx>
+# include <TopTools_IndexedMapOfShape.hxx>
+# include <BRep_Tool.hxx>
+# include <BRepAdaptor_Curve.hxx>
+# include <BRepAdaptor_Surface.hxx>
+# include <Geom_BSplineCurve.hxx>
+# include <Geom_BSplineSurface.hxx>
 #endif
 
 #include <XCAFDoc_ShapeMapTool.hxx>
 
+#include <QtConcurrentMap>
+
 #include <boost/format.hpp>
 #include <boost/regex.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/range/algorithm/replace_if.hpp>
+#include <boost/functional/hash.hpp>
 #include <Base/Parameter.h>
 #include <Base/Console.h>
 #include <Base/FileInfo.h>
@@ -187,6 +198,7 @@ ImportOCAF2::ImportOCAF2(Handle(TDocStd_Document) h, App::Document* d, const std
     importHidden = hGrp->GetBool("ImportHiddenObject",true);
     reduceObjects = hGrp->GetBool("ReduceObjects",true);
     showProgress = hGrp->GetBool("ShowProgress",true);
+    parallelImport = hGrp->GetBool("ParallelImport",true);
 
     if(d->isSaved()) {
         Base::FileInfo fi(d->FileName.getValue());
@@ -297,6 +309,16 @@ bool ImportOCAF2::getColor(const TopoDS_Shape &shape, Info &info, bool check, bo
     return ret;
 }
 
+struct ImportOCAF2::SubShapeColor {
+    TopoDS_Shape shape;
+    App::Color faceColor;
+    App::Color edgeColor;
+    bool foundFaceColor = false;
+    bool checkFaceColor = false;
+    bool checkEdgeColor = false;
+    bool firstPass = false;
+};
+
 struct ImportOCAF2::ColorInfo {
     Part::TopoShape tshape;
     std::vector<App::Color> faceColors;
@@ -305,6 +327,10 @@ struct ImportOCAF2::ColorInfo {
     App::Color edgeColor;
     bool hasFaceColor = false;
     bool hasEdgeColor = false;
+    bool hasFaceColors = false;
+    bool hasEdgeColors = false;
+    bool hasSubShapes = false;
+    std::vector<SubShapeColor> subShapes;
 };
 
 // Check for uniform color
@@ -327,85 +353,185 @@ static void mergeColor(bool &hasColors, App::Color &color, std::vector<App::Colo
     colors.clear();
 }
 
-bool ImportOCAF2::createObject(App::Document *doc, TDF_Label label, 
-        const TopoDS_Shape &shape, Info &info, bool newDoc)
+void ImportOCAF2::readColors(TDF_Label label, const TopoDS_Shape &shape, Info &info, ColorInfo &colors)
 {
-    if(shape.IsNull() || !TopExp_Explorer(shape,TopAbs_VERTEX).More()) {
-        FC_WARN(labelName(label) << " has empty shape");
-        return false;
-    }
-
     getColor(shape,info);
-    bool hasFaceColors = false;
-    bool hasEdgeColors = false;
 
-    ColorInfo colors;
     colors.tshape.setShape(shape);
-    Part::TopoShape &tshape = colors.tshape;
+    colors.faceColor = info.faceColor;
+    colors.edgeColor = info.edgeColor;
+    colors.hasFaceColor = info.hasFaceColor;
+    colors.hasEdgeColor = info.hasEdgeColor;
 
     TDF_LabelSequence seq;
-    if(!label.IsNull() && aShapeTool->GetSubShapes(label,seq)) {
-        colors.faceColors.assign(tshape.countSubShapes(TopAbs_FACE),info.faceColor);
-        colors.edgeColors.assign(tshape.countSubShapes(TopAbs_EDGE),info.edgeColor);
-        // Two passes to get sub shape colors. First pass, look for solid, and
-        // second pass look for face and edges. This allows lower level
-        // subshape to override color of higher level ones.
-        for(int j=0;j<2;++j) {
-            for(int i=1;i<=seq.Length();++i) {
-                TDF_Label l = seq.Value(i);
-                TopoDS_Shape subShape = aShapeTool->GetShape(l);
-                if(subShape.IsNull())
-                    continue;
-                if(subShape.ShapeType()==TopAbs_FACE || subShape.ShapeType()==TopAbs_EDGE) {
-                    if(j==0)
-                        continue;
-                }else if(j!=0)
+    if(label.IsNull() || !aShapeTool->GetSubShapes(label,seq))
+        return;
+
+    colors.hasSubShapes = true;
+    // Two passes to get sub shape colors. First pass, look for solid, and
+    // second pass look for face and edges. This allows lower level
+    // subshape to override color of higher level ones.
+    for(int j=0;j<2;++j) {
+        for(int i=1;i<=seq.Length();++i) {
+            TDF_Label l = seq.Value(i);
+            TopoDS_Shape subShape = aShapeTool->GetShape(l);
+            if(subShape.IsNull())
+                continue;
+            if(subShape.ShapeType()==TopAbs_FACE || subShape.ShapeType()==TopAbs_EDGE) {
+                if(j==0)
                     continue;
+            }else if(j!=0)
+                continue;
 
-                bool foundFaceColor = false;
-                bool checkSubFaceColor = false;
-                bool checkSubEdgeColor = false;
-                App::Color faceColor,edgeColor;
-                Quantity_ColorRGBA aColor;
-                if(aColorTool->GetColor(l, XCAFDoc_ColorSurf, aColor) ||
-                   aColorTool->GetColor(l, XCAFDoc_ColorGen, aColor))
-                {
-                    foundFaceColor = true;
-                    faceColor = convertColor(aColor);
-                    checkSubFaceColor = faceColor!=info.faceColor;
-                }
-                if(aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
-                    edgeColor = convertColor(aColor);
-                    checkSubEdgeColor = edgeColor!=info.edgeColor;
-                    if(j==0 && foundFaceColor && colors.faceColors.size() && edgeColor==faceColor) {
-                        // Do not set edge the same color as face
-                        checkSubEdgeColor = false;
-                    }
-                }
+            SubShapeColor sub;
+            sub.shape = subShape;
+            sub.firstPass = j==0;
+            Quantity_ColorRGBA aColor;
+            if(aColorTool->GetColor(l, XCAFDoc_ColorSurf, aColor) ||
+               aColorTool->GetColor(l, XCAFDoc_ColorGen, aColor))
+            {
+                sub.foundFaceColor = true;
+                sub.faceColor = convertColor(aColor);
+                sub.checkFaceColor = sub.faceColor!=info.faceColor;
+            }
+            if(aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
+                sub.edgeColor = convertColor(aColor);
+                sub.checkEdgeColor = sub.edgeColor!=info.edgeColor;
+            }
+            if(sub.checkFaceColor || sub.checkEdgeColor)
+                colors.subShapes.push_back(std::move(sub));
+        }
+    }
+}
 
-                if(checkSubFaceColor) {
-                    for(TopExp_Explorer exp(subShape,TopAbs_FACE);exp.More();exp.Next()) {
-                        int idx = tshape.findShape(exp.Current())-1;
-                        if(idx>=0 && idx<(int)colors.faceColors.size()) {
-                            colors.faceColors[idx] = faceColor;
-                            hasFaceColors = true;
-                            info.hasFaceColor = true;
-                        }
-                    }
+void ImportOCAF2::mapColors(ColorInfo &colors)
+{
+    // Only touches the TopoShape owned by 'colors', so that it is safe to be
+    // called for different shapes concurrently.
+    if(!colors.hasSubShapes)
+        return;
+
+    Part::TopoShape &tshape = colors.tshape;
+    colors.faceColors.assign(tshape.countSubShapes(TopAbs_FACE),colors.faceColor);
+    colors.edgeColors.assign(tshape.countSubShapes(TopAbs_EDGE),colors.edgeColor);
+
+    for(auto &sub : colors.subShapes) {
+        bool checkSubEdgeColor = sub.checkEdgeColor;
+        if(sub.firstPass && sub.foundFaceColor && colors.faceColors.size() && sub.edgeColor==sub.faceColor) {
+            // Do not set edge the same color as face
+            checkSubEdgeColor = false;
+        }
+
+        if(sub.checkFaceColor) {
+            for(TopExp_Explorer exp(sub.shape,TopAbs_FACE);exp.More();exp.Next()) {
+                int idx = tshape.findShape(exp.Current())-1;
+                if(idx>=0 && idx<(int)colors.faceColors.size()) {
+                    colors.faceColors[idx] = sub.faceColor;
+                    colors.hasFaceColors = true;
+                    colors.hasFaceColor = true;
                 }
-                if(checkSubEdgeColor) {
-                    for(TopExp_Explorer exp(subShape,TopAbs_EDGE);exp.More();exp.Next()) {
-                        int idx = tshape.findShape(exp.Current())-1;
-                        if(idx>=0 && idx<(int)colors.edgeColors.size()) {
-                            colors.edgeColors[idx] = edgeColor;
-                            hasEdgeColors = true;
-                            info.hasEdgeColor = true;
-                        }
-                    }
+            }
+        }
+        if(checkSubEdgeColor) {
+            for(TopExp_Explorer exp(sub.shape,TopAbs_EDGE);exp.More();exp.Next()) {
+                int idx = tshape.findShape(exp.Current())-1;
+                if(idx>=0 && idx<(int)colors.edgeColors.size()) {
+                    colors.edgeColors[idx] = sub.edgeColor;
+                    colors.hasEdgeColors = true;
+                    colors.hasEdgeColor = true;
                 }
             }
         }
     }
+    colors.subShapes.clear();
+}
+
+void ImportOCAF2::collectShapes(const TopoDS_Shape &shape,
+                                std::unordered_set<TopoDS_Shape, ShapeHasher> &visited,
+                                std::vector<std::shared_ptr<ColorInfo> > &tasks)
+{
+    if(shape.IsNull())
+        return;
+
+    auto baseShape = shape.Located(TopLoc_Location());
+    if(!visited.insert(baseShape).second)
+        return;
+
+    auto baseLabel = aShapeTool->FindShape(baseShape);
+    if(!baseLabel.IsNull() && aShapeTool->IsAssembly(baseLabel)) {
+        for(TopoDS_Iterator it(baseShape,0,0);it.More();it.Next()) {
+            TopoDS_Shape childShape = it.Value();
+            if(childShape.IsNull())
+                continue;
+            if(!importHidden) {
+                TDF_Label childLabel;
+                aShapeTool->Search(childShape,childLabel,Standard_True,Standard_True,Standard_False);
+                if(!childLabel.IsNull() && !aColorTool->IsVisible(childLabel))
+                    continue;
+            }
+            collectShapes(childShape,visited,tasks);
+        }
+        return;
+    }
+
+    if(!TopExp_Explorer(baseShape,TopAbs_VERTEX).More())
+        return;
+
+    Info info;
+    auto colors = std::make_shared<ColorInfo>();
+    readColors(baseLabel,baseShape,info,*colors);
+    myPreparedShapes.emplace(baseShape,colors);
+    tasks.push_back(colors);
+}
+
+void ImportOCAF2::prepareShapes(const TDF_LabelSequence &labels)
+{
+    // The XCAF queries are not thread safe (the shape tool builds its lookup
+    // maps lazily), so the label tree is walked here and only the TopoShape
+    // work of the individual shapes runs concurrently. The document objects
+    // are still created one by one in loadShape().
+    std::unordered_set<TopoDS_Shape, ShapeHasher> visited;
+    std::vector<std::shared_ptr<ColorInfo> > tasks;
+    for (Standard_Integer i=1; i <= labels.Length(); i++ ) {
+        auto label = labels.Value(i);
+        if(!importHidden && !aColorTool->IsVisible(label))
+            continue;
+        collectShapes(aShapeTool->GetShape(label),visited,tasks);
+    }
+
+    FC_LOG("prepare " << tasks.size() << " shapes");
+    QtConcurrent::blockingMap(tasks, [](std::shared_ptr<ColorInfo> &colors) {
+        mapColors(*colors);
+        // build the sub-shape cache of the TopoShape in the worker thread
+        colors->tshape.countSubShapes(TopAbs_VERTEX);
+    });
+}
+
+bool ImportOCAF2::createObject(App::Document *doc, TDF_Label label, 
+        const TopoDS_Shape &shape, Info &info, bool newDoc)
+{
+    if(shape.IsNull() || !TopExp_Explorer(shape,TopAbs_VERTEX).More()) {
+        FC_WARN(labelName(label) << " has empty shape");
+        return false;
+    }
+
+    ColorInfo colors;
+    auto itPrepared = myPreparedShapes.find(shape);
+    if(itPrepared != myPreparedShapes.end()) {
+        colors = std::move(*itPrepared->second);
+        myPreparedShapes.erase(itPrepared);
+    } else {
+        readColors(label,shape,info,colors);
+        mapColors(colors);
+    }
+
+    Part::TopoShape &tshape = colors.tshape;
+    info.faceColor = colors.faceColor;
+    info.edgeColor = colors.edgeColor;
+    info.hasFaceColor = colors.hasFaceColor;
+    info.hasEdgeColor = colors.hasEdgeColor;
+    bool hasFaceColors = colors.hasFaceColors;
+    bool hasEdgeColors = colors.hasEdgeColors;
 
     Part::Feature *feature;
 
@@ -421,7 +547,8 @@ bool ImportOCAF2::createObject(App::Document *doc, TDF_Label label,
     colors.hasEdgeColor = info.hasEdgeColor;
 
     feature = static_cast<Part::Feature*>(doc->addObject("Part::Feature",tshape.shapeName().c_str()));
-    feature->Shape.setValue(shape);
+    // assign the TopoShape to keep its sub-shape cache
+    feature->Shape.setValue(tshape);
     // feature->Visibility.setValue(false);
 
     applyFaceColors(feature,{info.faceColor});
@@ -590,11 +717,14 @@ App::DocumentObject* ImportOCAF2::loadShapes()
     myShapes.clear();
     myNames.clear();
     myCollapsedObjects.clear();
+    myPreparedShapes.clear();
     myNewDocuments.clear();
     myDocumentStack.clear();
 
     std::vector<App::DocumentObject*> objs;
     aShapeTool->GetFreeShapes (labels);
+    if(parallelImport)
+        prepareShapes(labels);
     boost::dynamic_bitset<> vis;
     int count = 0;
     for (Standard_Integer i=1; i <= labels.Length(); i++ ) {
@@ -644,6 +774,7 @@ App::DocumentObject* ImportOCAF2::loadShapes()
         ret->recomputeFeature(true);
     }
     sequencer = 0;
+    myPreparedShapes.clear();
     for (auto doc : myNewDocuments)
         doc->setUndoMode(1);
     return ret;
@@ -984,6 +1115,7 @@ ExportOCAF2::ExportOCAF2(Handle(TDocStd_Document) h, GetShapeColorsFunc func)
     auto hGrp = App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Import");
     exportHidden = hGrp->GetBool("ExportHiddenObject",true);
     keepPlacement = hGrp->GetBool("ExportKeepPlacement",false);
+    shareGeometry = hGrp->GetBool("ExportShareGeometry",false);
 
     Interface_Static::SetIVal("write.step.assembly",2);
 
@@ -1208,12 +1340,254 @@ void ExportOCAF2::setupObject(TDF_Label label, App::DocumentObject *obj,
     }
 }
 
+static inline void appendPoint(std::vector<double> &data, const gp_Pnt &p) {
+    data.push_back(p.X());
+    data.push_back(p.Y());
+    data.push_back(p.Z());
+}
+
+static inline void appendDir(std::vector<double> &data, const gp_Dir &d) {
+    data.push_back(d.X());
+    data.push_back(d.Y());
+    data.push_back(d.Z());
+}
+
+static inline void appendAxis(std::vector<double> &data, const gp_Ax3 &ax) {
+    appendPoint(data, ax.Location());
+    appendDir(data, ax.Direction());
+    appendDir(data, ax.XDirection());
+}
+
+static bool appendCurve(std::vector<double> &data, const TopoDS_Edge &edge) {
+    if(BRep_Tool::Degenerated(edge)) {
+        data.push_back(-1);
+        return true;
+    }
+    BRepAdaptor_Curve adapt(edge);
+    data.push_back(adapt.GetType());
+    data.push_back(adapt.FirstParameter());
+    data.push_back(adapt.LastParameter());
+    switch(adapt.GetType()) {
+    case GeomAbs_Line:
+        appendPoint(data, adapt.Line().Location());
+        appendDir(data, adapt.Line().Direction());
+        return true;
+    case GeomAbs_Circle: {
+        gp_Circ c = adapt.Circle();
+        appendAxis(data, gp_Ax3(c.Position()));
+        data.push_back(c.Radius());
+        return true;
+    }
+    case GeomAbs_Ellipse: {
+        gp_Elips e = adapt.Ellipse();
+        appendAxis(data, gp_Ax3(e.Position()));
+        data.push_back(e.MajorRadius());
+        data.push_back(e.MinorRadius());
+        return true;
+    }
+    case GeomAbs_BSplineCurve: {
+        Handle(Geom_BSplineCurve) spline = adapt.BSpline();
+        data.push_back(spline->Degree());
+        data.push_back(spline->IsRational()?1:0);
+        for(int i=1; i<=spline->NbPoles(); ++i) {
+            appendPoint(data, spline->Pole(i));
+            data.push_back(spline->Weight(i));
+        }
+        for(int i=1; i<=spline->NbKnots(); ++i) {
+            data.push_back(spline->Knot(i));
+            data.push_back(spline->Multiplicity(i));
+        }
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+static bool appendSurface(std::vector<double> &data, const TopoDS_Face &face) {
+    BRepAdaptor_Surface adapt(face, Standard_False);
+    data.push_back(adapt.GetType());
+    switch(adapt.GetType()) {
+    case GeomAbs_Plane:
+        appendAxis(data, adapt.Plane().Position());
+        return true;
+    case GeomAbs_Cylinder:
+        appendAxis(data, adapt.Cylinder().Position());
+        data.push_back(adapt.Cylinder().Radius());
+        return true;
+    case GeomAbs_Cone:
+        appendAxis(data, adapt.Cone().Position());
+        data.push_back(adapt.Cone().RefRadius());
+        data.push_back(adapt.Cone().SemiAngle());
+        return true;
+    case GeomAbs_Sphere:
+        appendAxis(data, adapt.Sphere().Position());
+        data.push_back(adapt.Sphere().Radius());
+        return true;
+    case GeomAbs_Torus:
+        appendAxis(data, adapt.Torus().Position());
+        data.push_back(adapt.Torus().MajorRadius());
+        data.push_back(adapt.Torus().MinorRadius());
+        return true;
+    case GeomAbs_BSplineSurface: {
+        Handle(Geom_BSplineSurface) spline = adapt.BSpline();
+        data.push_back(spline->UDegree());
+        data.push_back(spline->VDegree());
+        data.push_back(spline->NbUPoles());
+        data.push_back(spline->NbVPoles());
+        for(int i=1; i<=spline->NbUPoles(); ++i) {
+            for(int j=1; j<=spline->NbVPoles(); ++j) {
+                appendPoint(data, spline->Pole(i,j));
+                data.push_back(spline->Weight(i,j));
+            }
+        }
+        for(int i=1; i<=spline->NbUKnots(); ++i) {
+            data.push_back(spline->UKnot(i));
+            data.push_back(spline->UMultiplicity(i));
+        }
+        for(int i=1; i<=spline->NbVKnots(); ++i) {
+            data.push_back(spline->VKnot(i));
+            data.push_back(spline->VMultiplicity(i));
+        }
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+// Only reads the given shape, so it is safe to be called concurrently
+static void computeFingerprint(const TopoDS_Shape &shape, std::vector<double> &data, bool &shareable) {
+    TopTools_IndexedMapOfShape vertexMap, edgeMap, faceMap;
+    TopExp::MapShapes(shape, TopAbs_VERTEX, vertexMap);
+    TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+
+    data.push_back(shape.ShapeType());
+    data.push_back(shape.Orientation());
+    data.push_back(vertexMap.Extent());
+    data.push_back(edgeMap.Extent());
+    data.push_back(faceMap.Extent());
+
+    for(int i=1; i<=vertexMap.Extent(); ++i)
+        appendPoint(data, BRep_Tool::Pnt(TopoDS::Vertex(vertexMap(i))));
+
+    for(int i=1; i<=edgeMap.Extent() && shareable; ++i) {
+        const TopoDS_Edge &edge = TopoDS::Edge(edgeMap(i));
+        shareable = appendCurve(data, edge);
+        for(TopExp_Explorer xp(edge, TopAbs_VERTEX); xp.More(); xp.Next()) {
+            data.push_back(vertexMap.FindIndex(xp.Current()));
+            data.push_back(xp.Current().Orientation());
+        }
+    }
+
+    for(int i=1; i<=faceMap.Extent() && shareable; ++i) {
+        const TopoDS_Face &face = TopoDS::Face(faceMap(i));
+        shareable = appendSurface(data, face);
+        data.push_back(face.Orientation());
+        for(TopExp_Explorer xp(face, TopAbs_EDGE); xp.More(); xp.Next()) {
+            data.push_back(edgeMap.FindIndex(xp.Current()));
+            data.push_back(xp.Current().Orientation());
+        }
+    }
+}
+
+std::shared_ptr<ExportOCAF2::ShapeFingerprint> ExportOCAF2::getFingerprint(const TopoDS_Shape &baseShape)
+{
+    auto &fp = myFingerprints[baseShape];
+    if(!fp) {
+        fp = std::make_shared<ShapeFingerprint>();
+        computeFingerprint(baseShape, fp->data, fp->shareable);
+        fp->hash = boost::hash_range(fp->data.begin(), fp->data.end());
+    }
+    return fp;
+}
+
+void ExportOCAF2::prepareShapes(const std::vector<App::DocumentObject*> &objs)
+{
+    // Collect the shapes of all leaf objects and compute their fingerprints
+    // in parallel. The document objects themselves are only accessed here.
+    std::vector<std::pair<TopoDS_Shape, std::shared_ptr<ShapeFingerprint> > > tasks;
+    std::set<App::DocumentObject*> visited;
+    std::vector<App::DocumentObject*> stack(objs.rbegin(), objs.rend());
+    while(!stack.empty()) {
+        auto obj = stack.back();
+        stack.pop_back();
+        if(!obj || !obj->getNameInDocument() || !visited.insert(obj).second)
+            continue;
+        auto subs = obj->getSubObjects();
+        if(subs.empty()) {
+            auto linked = obj->getLinkedObject(true);
+            if(!linked)
+                continue;
+            auto shape = Part::Feature::getTopoShape(linked);
+            if(shape.isNull())
+                continue;
+            auto baseShape = shape.getShape().Located(TopLoc_Location());
+            auto &fp = myFingerprints[baseShape];
+            if(fp)
+                continue;
+            fp = std::make_shared<ShapeFingerprint>();
+            tasks.emplace_back(baseShape, fp);
+            continue;
+        }
+        for(auto rit=subs.rbegin(); rit!=subs.rend(); ++rit)
+            stack.push_back(obj->getSubObject(rit->c_str()));
+    }
+
+    FC_LOG("prepare " << tasks.size() << " shapes");
+    QtConcurrent::blockingMap(tasks,
+        [](std::pair<TopoDS_Shape, std::shared_ptr<ShapeFingerprint> > &task) {
+            auto &fp = *task.second;
+            computeFingerprint(task.first, fp.data, fp.shareable);
+            fp.hash = boost::hash_range(fp.data.begin(), fp.data.end());
+        });
+}
+
+TDF_Label ExportOCAF2::findSharedShape(const Part::TopoShape &baseShape, App::DocumentObject *obj)
+{
+    auto fp = getFingerprint(baseShape.getShape());
+    if(!fp->shareable)
+        return TDF_Label();
+    auto it = mySharedShapes.find(fp->hash);
+    if(it == mySharedShapes.end())
+        return TDF_Label();
+    for(auto &shared : it->second) {
+        if(shared.fingerprint->data != fp->data)
+            continue;
+        // Element colors are stored with the prototype shape, so it can only
+        // be shared by objects with the same colors.
+        if(getShapeColors && shared.obj != obj
+                && (getShapeColors(shared.obj,"Face*") != getShapeColors(obj,"Face*")
+                    || getShapeColors(shared.obj,"Edge*") != getShapeColors(obj,"Edge*")))
+            continue;
+        return shared.label;
+    }
+    return TDF_Label();
+}
+
+void ExportOCAF2::addSharedShape(const Part::TopoShape &baseShape, App::DocumentObject *obj, TDF_Label label)
+{
+    auto fp = getFingerprint(baseShape.getShape());
+    if(!fp->shareable)
+        return;
+    SharedShape shared;
+    shared.fingerprint = fp;
+    shared.obj = obj;
+    shared.label = label;
+    mySharedShapes[fp->hash].push_back(shared);
+}
+
 void ExportOCAF2::exportObjects(std::vector<App::DocumentObject*> &objs, const char *name) {
     if(objs.empty())
         return;
     myObjects.clear();
     myNames.clear();
     mySetups.clear();
+    myFingerprints.clear();
+    mySharedShapes.clear();
+    if(shareGeometry)
+        prepareShapes(objs);
     if(objs.size()==1)
         exportObject(objs.front(),0,TDF_Label());
     else {
@@ -1327,9 +1701,21 @@ TDF_Label ExportOCAF2::exportObject(App::DocumentObject* parentObj,
                 auto baseShape = linkedShape;
                 auto linked = links.empty()?obj:links.back();
                 baseShape.setShape(baseShape.getShape().Located(TopLoc_Location()),false);
-                label = aShapeTool->NewShape();
-                aShapeTool->SetShape(label,baseShape.getShape());
-                setupObject(label,linked,baseShape,prefix);
+                TDF_Label sharedLabel;
+                if(shareGeometry)
+                    sharedLabel = findSharedShape(baseShape,linked);
+                if(!sharedLabel.IsNull()) {
+                    // Identical geometry has been exported before. Swap in
+                    // the shared prototype shape but keep our location.
+                    shape.setShape(Part::TopoShape::located(aShapeTool->GetShape(sharedLabel),
+                                shape.getShape().Location()),false);
+                } else {
+                    label = aShapeTool->NewShape();
+                    aShapeTool->SetShape(label,baseShape.getShape());
+                    setupObject(label,linked,baseShape,prefix);
+                    if(shareGeometry)
+                        addSharedShape(baseShape,linked,label);
+                }
             }
 
             label = aShapeTool->AddComponent(parent,shape.getShape(),Standard_False);
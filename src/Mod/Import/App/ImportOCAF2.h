@@ -33,6 +33,8 @@
 #include <set>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
+#include <memory>
 #include <vector>
 #include <App/Material.h>
 #include <App/Part.h>
@@ -82,6 +84,7 @@ public:
     void setImportHiddenObject(bool enable) {importHidden=enable;}
     void setReduceObjects(bool enable) {reduceObjects=enable;}
     void setShowProgress(bool enable) {showProgress=enable;}
+    void setParallelImport(bool enable) {parallelImport=enable;}
 
     enum ImportMode {
         SingleDoc = 0,
@@ -106,8 +109,16 @@ private:
         int free = true;
     };
 
+    struct SubShapeColor;
     struct ColorInfo;
 
+    void prepareShapes(const TDF_LabelSequence &labels);
+    void collectShapes(const TopoDS_Shape &shape,
+            std::unordered_set<TopoDS_Shape, ShapeHasher> &visited,
+            std::vector<std::shared_ptr<ColorInfo> > &tasks);
+    void readColors(TDF_Label label, const TopoDS_Shape &shape, Info &info, ColorInfo &colors);
+    static void mapColors(ColorInfo &colors);
+
     App::DocumentObject *loadShape(App::Document *doc, TDF_Label label, 
             const TopoDS_Shape &shape, bool baseOnly=false, bool newDoc=true);
     App::Document *getDocument(App::Document *doc, TDF_Label label);
@@ -156,6 +167,7 @@ private:
     bool importHidden;
     bool reduceObjects;
     bool showProgress;
+    bool parallelImport;
 
     int mode;
     std::string filePath;
@@ -163,6 +175,7 @@ private:
     std::unordered_map<TopoDS_Shape, Info, ShapeHasher> myShapes;
     std::unordered_map<TDF_Label, std::string, LabelHasher> myNames;
     std::unordered_map<App::DocumentObject*, App::PropertyPlacement*> myCollapsedObjects;
+    std::unordered_map<TopoDS_Shape, std::shared_ptr<ColorInfo>, ShapeHasher> myPreparedShapes;
 
     struct DocumentInfo {
         App::Document *doc;
@@ -189,6 +202,14 @@ public:
 
     void setExportHiddenObject(bool enable) {exportHidden=enable;}
     void setKeepPlacement(bool enable) {keepPlacement=enable;}
+    /** Export identical geometry only once
+     *
+     * If enabled, shapes with the same geometry are exported as a single
+     * prototype shape that is referenced by located components, even if they
+     * belong to different objects. The geometry of all exported shapes is
+     * compared in parallel before the export starts.
+     */
+    void setShareGeometry(bool enable) {shareGeometry=enable;}
     void exportObjects(std::vector<App::DocumentObject*> &objs, const char *name=0);
     bool canFallback(std::vector<App::DocumentObject*> objs);
 
@@ -200,6 +221,22 @@ private:
     void setName(TDF_Label label, App::DocumentObject *obj, const char *name=0);
     TDF_Label findComponent(const char *subname, TDF_Label label, TDF_LabelSequence &labels);
 
+    /// Topology and geometry summary used to detect identical shapes
+    struct ShapeFingerprint {
+        std::size_t hash = 0;
+        bool shareable = true;
+        std::vector<double> data;
+    };
+    struct SharedShape {
+        std::shared_ptr<ShapeFingerprint> fingerprint;
+        App::DocumentObject *obj;
+        TDF_Label label;
+    };
+    void prepareShapes(const std::vector<App::DocumentObject*> &objs);
+    std::shared_ptr<ShapeFingerprint> getFingerprint(const TopoDS_Shape &baseShape);
+    TDF_Label findSharedShape(const Part::TopoShape &baseShape, App::DocumentObject *obj);
+    void addSharedShape(const Part::TopoShape &baseShape, App::DocumentObject *obj, TDF_Label label);
+
 private:
     Handle(TDocStd_Document) pDoc;
     Handle(XCAFDoc_ShapeTool) aShapeTool;
@@ -213,11 +250,15 @@ private:
 
     std::vector<App::DocumentObject*> groupLinks;
 
+    std::unordered_map<TopoDS_Shape, std::shared_ptr<ShapeFingerprint>, ShapeHasher> myFingerprints;
+    std::unordered_map<std::size_t, std::vector<SharedShape> > mySharedShapes;
+
     GetShapeColorsFunc getShapeColors;
 
     App::Color defaultColor;
     bool exportHidden;
     bool keepPlacement;
+    bool shareGeometry;
 };
 
 }
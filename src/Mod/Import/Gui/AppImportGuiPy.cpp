@@ -584,9 +584,10 @@ private:
         PyObject *exportHidden = Py_None;
         PyObject *legacy = Py_None;
         PyObject *keepPlacement = Py_None;
-        static char* kwd_list[] = {"obj", "name", "exportHidden", "legacy", "keepPlacement",0};
-        if(!PyArg_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "Oet|OOO",
-                    kwd_list,&object,"utf-8",&Name,&exportHidden,&legacy,&keepPlacement))
+        PyObject *shareGeometry = Py_None;
+        static char* kwd_list[] = {"obj", "name", "exportHidden", "legacy", "keepPlacement", "shareGeometry",0};
+        if(!PyArg_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "Oet|OOOO",
+                    kwd_list,&object,"utf-8",&Name,&exportHidden,&legacy,&keepPlacement,&shareGeometry))
             throw Py::Exception();
 
         std::string Utf8Name = std::string(Name);
@@ -618,6 +619,8 @@ private:
                     ocaf.setExportHiddenObject(PyObject_IsTrue(exportHidden));
                 if(keepPlacement!=Py_None)
                     ocaf.setKeepPlacement(PyObject_IsTrue(keepPlacement));
+                if(shareGeometry!=Py_None)
+                    ocaf.setShareGeometry(PyObject_IsTrue(shareGeometry));
                 ocaf.exportObjects(objs);
             }
             else {
@@ -50,6 +50,7 @@ for p in (("UseAppPart",True),
           ("ImportHiddenObject",True),
           ("ExportHiddenObject",True),
           ("ExportKeepPlacement",True),
+          ("ExportShareGeometry",False),
           ("ReduceObjects", False),
           ("ShowProgress", True)):
     _checkParamBool(paramGetV,*p)
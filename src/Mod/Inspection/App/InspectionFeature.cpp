@@ -23,13 +23,26 @@
 
 #include "PreCompiled.h"
 #include <numeric>
+#include <memory>
+#include <limits>
 #include <gp_Pnt.hxx>
+#include <gp_Pnt2d.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepAdaptor_Surface.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
-#include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepGProp_Face.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepTopAdaptor_FClass2d.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Precision.hxx>
+#include <Standard_Version.hxx>
+#include <TopExp.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
 #include <TopoDS_Vertex.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 
 #include <QEventLoop>
 #include <QFuture>
@@ -129,6 +142,244 @@ Base::Vector3f InspectActualShape::getPoint(unsigned long index) const
 
 // ----------------------------------------------------------------
 
+namespace Inspection {
+/** A bounding volume hierarchy over a set of triangles to find the triangle
+ * nearest to a point. Once built it can be queried from several threads.
+ */
+class TriangleBVH
+{
+public:
+    struct Triangle {
+        Base::Vector3d points[3];
+        unsigned long index; // index of the triangle in the caller's data
+    };
+    struct Hit {
+        unsigned long index;
+        std::size_t slot;     // position of the triangle in the hierarchy
+        const Base::Vector3d* triangle;
+        Base::Vector3d point; // nearest point on the triangle
+        double bary[3];       // barycentric coordinates of the nearest point
+        double distance;
+    };
+
+    explicit TriangleBVH(std::vector<Triangle>&& tria)
+        : triangles(std::move(tria))
+    {
+        if (!triangles.empty()) {
+            nodes.reserve(2 * triangles.size() / LeafSize + 1);
+            build(0, triangles.size());
+        }
+    }
+
+    /** Searches the nearest triangle within \a maxDist to \a pnt.
+     * The triangle of \a hint, the hit of a nearby point, is tested first and
+     * bounds the search, which prunes most of the tree for coherent points.
+     */
+    bool nearest(const Base::Vector3d& pnt, double maxDist, Hit& hit,
+                 const Hit* hint = nullptr) const
+    {
+        if (nodes.empty())
+            return false;
+
+        double best = maxDist * maxDist;
+        bool found = false;
+        if (hint) {
+            std::size_t slot = hint->slot;
+            Base::Vector3d point;
+            double bary[3];
+            double dist = closestPoint(triangles[slot], pnt, point, bary);
+            if (dist <= best) {
+                best = dist;
+                found = true;
+                setHit(hit, slot, point, bary);
+            }
+        }
+        // the tree is split at the median so its depth is always far below 64
+        std::size_t stack[64];
+        int top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            std::size_t index = stack[--top];
+            const Node& node = nodes[index];
+            if (distanceToBox(node.box, pnt) > best)
+                continue;
+            if (node.count > 0) {
+                for (std::size_t i = node.first; i < node.first + node.count; i++) {
+                    Base::Vector3d point;
+                    double bary[3];
+                    double dist = closestPoint(triangles[i], pnt, point, bary);
+                    if (dist <= best) {
+                        best = dist;
+                        found = true;
+                        setHit(hit, i, point, bary);
+                    }
+                }
+            }
+            else {
+                std::size_t left = index + 1;
+                std::size_t right = node.first;
+                // visit the nearer child first
+                if (distanceToBox(nodes[left].box, pnt) < distanceToBox(nodes[right].box, pnt)) {
+                    stack[top++] = right;
+                    stack[top++] = left;
+                }
+                else {
+                    stack[top++] = left;
+                    stack[top++] = right;
+                }
+            }
+        }
+
+        if (found)
+            hit.distance = sqrt(best);
+        return found;
+    }
+
+private:
+    static const std::size_t LeafSize = 4;
+
+    struct Node {
+        Base::BoundBox3d box;
+        std::size_t first; // leaf: first triangle, inner node: index of the right child
+        std::size_t count; // number of triangles of a leaf, 0 for inner nodes
+    };
+
+    void setHit(Hit& hit, std::size_t slot, const Base::Vector3d& point, const double bary[3]) const
+    {
+        hit.index = triangles[slot].index;
+        hit.slot = slot;
+        hit.triangle = triangles[slot].points;
+        hit.point = point;
+        std::copy(bary, bary + 3, hit.bary);
+    }
+
+    static Base::Vector3d centroid(const Triangle& t)
+    {
+        return (t.points[0] + t.points[1] + t.points[2]) / 3.0;
+    }
+
+    std::size_t build(std::size_t first, std::size_t last)
+    {
+        std::size_t index = nodes.size();
+        nodes.emplace_back();
+
+        Base::BoundBox3d box, centers;
+        for (std::size_t i = first; i < last; i++) {
+            for (const auto& p : triangles[i].points)
+                box.Add(p);
+            centers.Add(centroid(triangles[i]));
+        }
+        nodes[index].box = box;
+
+        std::size_t count = last - first;
+        if (count <= LeafSize) {
+            nodes[index].first = first;
+            nodes[index].count = count;
+            return index;
+        }
+
+        // split at the median of the longest axis, the left child directly follows its parent
+        unsigned short axis = 0;
+        if (centers.LengthY() > centers.LengthX())
+            axis = 1;
+        if (centers.LengthZ() > std::max(centers.LengthX(), centers.LengthY()))
+            axis = 2;
+        std::size_t middle = first + count / 2;
+        std::nth_element(triangles.begin() + first, triangles.begin() + middle, triangles.begin() + last,
+                         [axis](const Triangle& a, const Triangle& b) {
+            return centroid(a)[axis] < centroid(b)[axis];
+        });
+
+        build(first, middle);
+        std::size_t right = build(middle, last);
+        nodes[index].first = right;
+        nodes[index].count = 0;
+        return index;
+    }
+
+    static double distanceToBox(const Base::BoundBox3d& box, const Base::Vector3d& p)
+    {
+        double dx = std::max(std::max(box.MinX - p.x, 0.0), p.x - box.MaxX);
+        double dy = std::max(std::max(box.MinY - p.y, 0.0), p.y - box.MaxY);
+        double dz = std::max(std::max(box.MinZ - p.z, 0.0), p.z - box.MaxZ);
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    // Returns the squared distance, see Ericson: Real-Time Collision Detection, 5.1.5
+    static double closestPoint(const Triangle& t, const Base::Vector3d& p,
+                               Base::Vector3d& q, double bary[3])
+    {
+        const Base::Vector3d& a = t.points[0];
+        const Base::Vector3d& b = t.points[1];
+        const Base::Vector3d& c = t.points[2];
+        Base::Vector3d ab = b - a;
+        Base::Vector3d ac = c - a;
+        Base::Vector3d ap = p - a;
+        double d1 = ab * ap;
+        double d2 = ac * ap;
+        Base::Vector3d bp = p - b;
+        double d3 = ab * bp;
+        double d4 = ac * bp;
+        Base::Vector3d cp = p - c;
+        double d5 = ab * cp;
+        double d6 = ac * cp;
+        double va = d3 * d6 - d5 * d4;
+        double vb = d5 * d2 - d1 * d6;
+        double vc = d1 * d4 - d3 * d2;
+
+        if (d1 <= 0 && d2 <= 0) {
+            bary[0] = 1; bary[1] = 0; bary[2] = 0;
+        }
+        else if (d3 >= 0 && d4 <= d3) {
+            bary[0] = 0; bary[1] = 1; bary[2] = 0;
+        }
+        else if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+            double v = d1 / (d1 - d3);
+            bary[0] = 1 - v; bary[1] = v; bary[2] = 0;
+        }
+        else if (d6 >= 0 && d5 <= d6) {
+            bary[0] = 0; bary[1] = 0; bary[2] = 1;
+        }
+        else if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+            double w = d2 / (d2 - d6);
+            bary[0] = 1 - w; bary[1] = 0; bary[2] = w;
+        }
+        else if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+            double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+            bary[0] = 0; bary[1] = 1 - w; bary[2] = w;
+        }
+        else if (va + vb + vc > 0) {
+            double denom = 1.0 / (va + vb + vc);
+            double v = vb * denom;
+            double w = vc * denom;
+            bary[0] = 1 - v - w; bary[1] = v; bary[2] = w;
+        }
+        else {
+            // degenerated triangle
+            bary[0] = 1; bary[1] = 0; bary[2] = 0;
+        }
+
+        q = a * bary[0] + b * bary[1] + c * bary[2];
+        return Base::DistanceP2(p, q);
+    }
+
+    std::vector<Triangle> triangles;
+    std::vector<Node> nodes;
+};
+}
+
+// ----------------------------------------------------------------
+
+void InspectNominalGeometry::getDistances(const std::vector<Base::Vector3f>& points,
+                                          std::vector<float>& distances) const
+{
+    distances.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); i++)
+        distances[i] = getDistance(points[i]);
+}
+
+// ----------------------------------------------------------------
+
 namespace Inspection {
     class MeshInspectGrid : public MeshCore::MeshGrid
     {
@@ -257,35 +508,56 @@ namespace Inspection {
     };
 }
 
-InspectNominalMesh::InspectNominalMesh(const Mesh::MeshObject& rMesh, float offset) : _mesh(rMesh.getKernel())
+InspectNominalMesh::InspectNominalMesh(const Mesh::MeshObject& rMesh, float offset)
 {
+    const MeshCore::MeshKernel& kernel = rMesh.getKernel();
     Base::Matrix4D tmp;
-    _clTrf = rMesh.getTransform();
-    _bApply = _clTrf != tmp;
-
-    // Max. limit of grid elements
-    float fMaxGridElements=8000000.0f;
-    Base::BoundBox3f box = _mesh.GetBoundBox().Transformed(rMesh.getTransform());
-
-    // estimate the minimum allowed grid length
-    float fMinGridLen = (float)pow((box.LengthX()*box.LengthY()*box.LengthZ()/fMaxGridElements), 0.3333f);
-    float fGridLen = 5.0f * MeshCore::MeshAlgorithm(_mesh).GetAverageEdgeLength();
-
-    // We want to avoid to get too small grid elements otherwise building up the grid structure would take
-    // too much time and memory. 
-    // Having quite a dense grid speeds up more the following algorithms extremely. Due to the issue above it's
-    // always a compromise between speed and memory usage.
-    fGridLen = std::max<float>(fMinGridLen, fGridLen);
+    Base::Matrix4D clTrf = rMesh.getTransform();
+    bool bApply = clTrf != tmp;
+
+    std::vector<TriangleBVH::Triangle> triangles;
+    triangles.reserve(kernel.CountFacets());
+    MeshCore::MeshFacetIterator clFIter(kernel);
+    if (bApply)
+        clFIter.Transform(clTrf);
+    unsigned long index = 0;
+    for (clFIter.Init(); clFIter.More(); clFIter.Next()) {
+        const MeshCore::MeshGeomFacet& face = *clFIter;
+        TriangleBVH::Triangle tria;
+        for (int i = 0; i < 3; i++)
+            tria.points[i] = Base::toVector<double>(face._aclPoints[i]);
+        tria.index = index++;
+        triangles.push_back(tria);
+    }
 
-    // build up grid structure to speed up algorithms
-    _pGrid = new MeshInspectGrid(_mesh, fGridLen, rMesh.getTransform());
-    _box = box;
+    _pBVH = new TriangleBVH(std::move(triangles));
+    _box = kernel.GetBoundBox().Transformed(clTrf);
     _box.Enlarge(offset);
 }
 
 InspectNominalMesh::~InspectNominalMesh()
 {
-    delete this->_pGrid;
+    delete this->_pBVH;
+}
+
+/* The distance is searched without limit, so that points beyond the search
+ * radius still get the sign of their side of the mesh. \a hasHit tells
+ * whether \a hit holds the nearest facet of a previous point.
+ */
+static float meshDistance(const TriangleBVH& bvh, const Base::Vector3f& point,
+                          TriangleBVH::Hit& hit, bool& hasHit)
+{
+    Base::Vector3d pnt = Base::toVector<double>(point);
+    if (!bvh.nearest(pnt, std::numeric_limits<double>::infinity(), hit, hasHit ? &hit : nullptr))
+        return FLT_MAX;
+    hasHit = true;
+
+    const Base::Vector3d* pts = hit.triangle;
+    float fMinDist = float(hit.distance);
+    Base::Vector3d normal = (pts[1] - pts[0]) % (pts[2] - pts[0]);
+    if ((pnt - pts[0]) * normal <= 0)
+        fMinDist = -fMinDist;
+    return fMinDist;
 }
 
 float InspectNominalMesh::getDistance(const Base::Vector3f& point) const
@@ -293,32 +565,25 @@ float InspectNominalMesh::getDistance(const Base::Vector3f& point) const
     if (!_box.IsInBox(point))
         return FLT_MAX; // must be inside bbox
 
-    std::vector<unsigned long> indices;
-    //_pGrid->GetElements(point, indices);
-    if (indices.empty()) {
-        std::set<unsigned long> inds;
-        _pGrid->MeshGrid::SearchNearestFromPoint(point, inds);
-        indices.insert(indices.begin(), inds.begin(), inds.end());
-    }
-
-    float fMinDist=FLT_MAX;
-    bool positive = true;
-    for (std::vector<unsigned long>::iterator it = indices.begin(); it != indices.end(); ++it) {
-        MeshCore::MeshGeomFacet geomFace = _mesh.GetFacet(*it);
-        if (_bApply) {
-            geomFace.Transform(_clTrf);
-        }
+    TriangleBVH::Hit hit;
+    bool hasHit = false;
+    return meshDistance(*_pBVH, point, hit, hasHit);
+}
 
-        float fDist = geomFace.DistanceToPoint(point);
-        if (fabs(fDist) < fabs(fMinDist)) {
-            fMinDist = fDist;
-            positive = point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) > 0;
-        }
+void InspectNominalMesh::getDistances(const std::vector<Base::Vector3f>& points,
+                                      std::vector<float>& distances) const
+{
+    // Consecutive points of a scan or mesh are close to each other, so the
+    // nearest facet of a point is a good first guess for the next one
+    TriangleBVH::Hit hit;
+    bool hasHit = false;
+    distances.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (!_box.IsInBox(points[i]))
+            distances[i] = FLT_MAX; // must be inside bbox
+        else
+            distances[i] = meshDistance(*_pBVH, points[i], hit, hasHit);
     }
-
-    if (!positive)
-        fMinDist = -fMinDist;
-    return fMinDist;
 }
 
 // ----------------------------------------------------------------
@@ -438,75 +703,277 @@ float InspectNominalPoints::getDistance(const Base::Vector3f& point) const
 
 // ----------------------------------------------------------------
 
-InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radius*/)
-    : _rShape(shape)
-    , isSolid(false)
+namespace Inspection {
+/** Tessellation of a shape that keeps track of the face and the surface
+ * parameters of each triangle.
+ */
+class ShapeTessellation
 {
-    distss = new BRepExtrema_DistShapeShape();
-    distss->LoadS1(_rShape);
+public:
+    struct Face {
+        TopoDS_Face face;
+        std::unique_ptr<BRepTopAdaptor_FClass2d> classifier;
+    };
+    struct Triangle {
+        std::size_t face;
+        bool hasUV;
+        gp_Pnt2d uv[3];
+        gp_Vec normal; // oriented like the face
+    };
+
+    ShapeTessellation(const TopoDS_Shape& shape, double deflection)
+        : bvh(nullptr), deflection(deflection)
+    {
+        std::vector<TriangleBVH::Triangle> tria;
+        if (!shape.IsNull()) {
+            // mesh a copy, the triangulation would otherwise be stored in the
+            // inspected shape
+            TopoDS_Shape copy = BRepBuilderAPI_Copy(shape, Standard_False).Shape();
+            BRepMesh_IncrementalMesh(copy, deflection, Standard_False, 0.5, Standard_True);
+
+            TopTools_IndexedMapOfShape map;
+            TopExp::MapShapes(copy, TopAbs_FACE, map);
+            for (int i = 1; i <= map.Extent(); i++)
+                addFace(TopoDS::Face(map(i)), tria);
+        }
+        bvh = new TriangleBVH(std::move(tria));
+    }
+    ~ShapeTessellation()
+    {
+        delete bvh;
+    }
+
+    TriangleBVH* bvh;
+    std::vector<Face> faces;
+    std::vector<Triangle> triangles;
+    double deflection;
+
+private:
+    void addFace(const TopoDS_Face& face, std::vector<TriangleBVH::Triangle>& tria)
+    {
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) hTria = BRep_Tool::Triangulation(face, loc);
+        if (hTria.IsNull())
+            return;
+
+        Face data;
+        data.face = face;
+        data.classifier.reset(new BRepTopAdaptor_FClass2d(face, Precision::PConfusion()));
+        faces.push_back(std::move(data));
+
+        gp_Trsf transf = loc.Transformation();
+        bool identity = loc.IsIdentity();
+        bool hasUV = hTria->HasUVNodes();
+        bool reversed = face.Orientation() != TopAbs_FORWARD;
+#if OCC_VERSION_HEX < 0x070600
+        const TColgp_Array1OfPnt& nodes = hTria->Nodes();
+        const Poly_Array1OfTriangle& polys = hTria->Triangles();
+#endif
+
+        for (int i = 1; i <= hTria->NbTriangles(); i++) {
+            Standard_Integer n[3];
+#if OCC_VERSION_HEX < 0x070600
+            polys(i).Get(n[0], n[1], n[2]);
+#else
+            hTria->Triangle(i).Get(n[0], n[1], n[2]);
+#endif
+            if (reversed)
+                std::swap(n[0], n[1]);
+
+            Triangle info;
+            info.face = faces.size() - 1;
+            info.hasUV = hasUV;
+            TriangleBVH::Triangle t;
+            t.index = triangles.size();
+            gp_Pnt p[3];
+            for (int j = 0; j < 3; j++) {
+#if OCC_VERSION_HEX < 0x070600
+                p[j] = nodes(n[j]);
+                if (hasUV)
+                    info.uv[j] = hTria->UVNodes()(n[j]);
+#else
+                p[j] = hTria->Node(n[j]);
+                if (hasUV)
+                    info.uv[j] = hTria->UVNode(n[j]);
+#endif
+                if (!identity)
+                    p[j].Transform(transf);
+                t.points[j].Set(p[j].X(), p[j].Y(), p[j].Z());
+            }
+            info.normal = gp_Vec(p[0], p[1]).Crossed(gp_Vec(p[0], p[2]));
+            triangles.push_back(info);
+            tria.push_back(t);
+        }
+    }
+};
 
-    // When having a solid then use its shell because otherwise the distance
-    // for inner points will always be zero
-    if (!_rShape.IsNull() && _rShape.ShapeType() == TopAbs_SOLID) {
-        TopExp_Explorer xp;
-        xp.Init(_rShape, TopAbs_SHELL);
-        if (xp.More()) {
-           distss->LoadS1(xp.Current());
-           isSolid = true;
+// Newton iteration for the foot point of pnt on the surface, starting at (u,v)
+static bool projectOnSurface(const BRepAdaptor_Surface& surf, const gp_Pnt& pnt,
+                             double& u, double& v, gp_Pnt& proj)
+{
+    const double tolU = surf.UResolution(Precision::Confusion());
+    const double tolV = surf.VResolution(Precision::Confusion());
+    const double u1 = surf.FirstUParameter();
+    const double u2 = surf.LastUParameter();
+    const double v1 = surf.FirstVParameter();
+    const double v2 = surf.LastVParameter();
+
+    for (int i = 0; i < 20; i++) {
+        gp_Vec du, dv, duu, dvv, duv;
+        surf.D2(u, v, proj, du, dv, duu, dvv, duv);
+        gp_Vec r(pnt, proj);
+        double f1 = r.Dot(du);
+        double f2 = r.Dot(dv);
+        double a11 = du.Dot(du) + r.Dot(duu);
+        double a12 = du.Dot(dv) + r.Dot(duv);
+        double a22 = dv.Dot(dv) + r.Dot(dvv);
+        double det = a11 * a22 - a12 * a12;
+        if (fabs(det) < 1e-20)
+            return false;
+
+        double deltaU = (a22 * f1 - a12 * f2) / det;
+        double deltaV = (a11 * f2 - a12 * f1) / det;
+        u = std::max(u1, std::min(u2, u - deltaU));
+        v = std::max(v1, std::min(v2, v - deltaV));
+        if (fabs(deltaU) <= tolU && fabs(deltaV) <= tolV) {
+            proj = surf.Value(u, v);
+            return true;
         }
+    }
+
+    return false;
+}
+}
+
+InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float offset)
+    : _rShape(shape)
+    , _offset(offset)
+    , isSolid(false)
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part");
+    float deviation = hGrp->GetFloat("MeshDeviation",0.2);
 
+    double deflection = 0.1;
+    if (!_rShape.IsNull()) {
+        Part::TopoShape tshape(_rShape);
+        Base::BoundBox3d bbox = tshape.getBoundBox();
+        deflection = (bbox.LengthX() + bbox.LengthY() + bbox.LengthZ())/300.0 * deviation;
+        // When having a solid the sign tells whether a point is inside
+        isSolid = _rShape.ShapeType() == TopAbs_SOLID;
     }
-    //distss->SetDeflection(radius);
+
+    _pMesh = new ShapeTessellation(_rShape, deflection);
 }
 
 InspectNominalShape::~InspectNominalShape()
 {
-    delete distss;
+    delete _pMesh;
 }
 
-float InspectNominalShape::getDistance(const Base::Vector3f& point) const
+namespace {
+// Surface of the face projected on last, consecutive points of a block mostly
+// project onto the same face
+struct FaceSurface
 {
-    gp_Pnt pnt3d(point.x,point.y,point.z);
-    BRepBuilderAPI_MakeVertex mkVert(pnt3d);
-    distss->LoadS2(mkVert.Vertex());
+    std::size_t face = std::numeric_limits<std::size_t>::max();
+    BRepAdaptor_Surface surf;
+    BRepGProp_Face props;
 
-    float fMinDist=FLT_MAX;
-    if (distss->Perform() && distss->NbSolution() > 0) {
-        fMinDist = (float)distss->Value();
-        // the shape is a solid, check if the vertex is inside
-        if (isSolid) {
-            const Standard_Real tol = 0.001;
-            BRepClass3d_SolidClassifier classifier(_rShape);
-            classifier.Perform(pnt3d, tol);
-            if (classifier.State() == TopAbs_IN) {
-                fMinDist = -fMinDist;
-            }
+    void load(const ShapeTessellation& mesh, std::size_t index)
+    {
+        if (face != index) {
+            face = index;
+            surf.Initialize(mesh.faces[index].face);
+            props.Load(mesh.faces[index].face);
+        }
+    }
+};
 
+float shapeDistance(const ShapeTessellation& mesh, float offset, bool isSolid,
+                    const Base::Vector3f& point, TriangleBVH::Hit& hit,
+                    bool& hasHit, FaceSurface& surface)
+{
+    Base::Vector3d pnt = Base::toVector<double>(point);
+    if (!mesh.bvh->nearest(pnt, std::numeric_limits<double>::infinity(), hit, hasHit ? &hit : nullptr))
+        return FLT_MAX;
+    hasHit = true;
+
+    const ShapeTessellation::Triangle& tria = mesh.triangles[hit.index];
+    const ShapeTessellation::Face& face = mesh.faces[tria.face];
+    gp_Pnt pnt3d(pnt.x, pnt.y, pnt.z);
+    gp_Vec offTria(gp_Pnt(hit.point.x, hit.point.y, hit.point.z), pnt3d);
+
+    // The tessellation may deviate from the surface by up to the deflection.
+    // Beyond the search radius only the side of the point matters.
+    if (hit.distance > offset + 2 * mesh.deflection) {
+        float fDist = float(hit.distance);
+        if (tria.normal.Dot(offTria) < 0)
+            fDist = -fDist;
+        return fDist;
+    }
+
+    // Refine the distance by projecting onto the surface of the nearest face
+    // starting at the parameters of the nearest point on the tessellation
+    if (tria.hasUV) {
+        double u = 0, v = 0;
+        for (int i = 0; i < 3; i++) {
+            u += hit.bary[i] * tria.uv[i].X();
+            v += hit.bary[i] * tria.uv[i].Y();
         }
-        else if (fMinDist > 0) {
-            // check if the distance was compued from a face
-            for (Standard_Integer index = 1; index <= distss->NbSolution(); index++) {
-                if (distss->SupportTypeShape1(index) == BRepExtrema_IsInFace) {
-                    TopoDS_Shape face = distss->SupportOnShape1(index);
-                    Standard_Real u, v;
-                    distss->ParOnFaceS1(index, u, v);
-                    //gp_Pnt pnt = distss->PointOnShape1(index);
-                    BRepGProp_Face props(TopoDS::Face(face));
-                    gp_Vec normal;
-                    gp_Pnt center;
-                    props.Normal(u, v, center, normal);
-                    gp_Vec dir(center, pnt3d);
-                    Standard_Real scalar = normal.Dot(dir);
-                    if (scalar < 0) {
-                        fMinDist = -fMinDist;
-                    }
-                    break;
-                }
+
+        gp_Pnt proj;
+        surface.load(mesh, tria.face);
+        if (projectOnSurface(surface.surf, pnt3d, u, v, proj)) {
+            double dist = pnt3d.Distance(proj);
+            TopAbs_State state = face.classifier->Perform(gp_Pnt2d(u, v));
+            // reject a projection onto the boundary or to a far away extremum
+            if (state == TopAbs_IN && dist <= hit.distance + 2 * mesh.deflection) {
+                gp_Vec normal;
+                gp_Pnt center;
+                surface.props.Normal(u, v, center, normal);
+                gp_Vec dir(center, pnt3d);
+                float fDist = float(dist);
+                if (normal.Dot(dir) < 0)
+                    fDist = -fDist;
+                return fDist;
             }
         }
     }
+
+    // The nearest point lies on the boundary of the face
+    float fMinDist = float(hit.distance);
+    BRepBuilderAPI_MakeVertex mkVert(pnt3d);
+    BRepExtrema_DistShapeShape distss(face.face, mkVert.Vertex());
+    if (distss.IsDone() && distss.NbSolution() > 0)
+        fMinDist = float(distss.Value());
+
+    // Only inside a solid a point near an edge gets a negative distance
+    if (isSolid && tria.normal.Dot(offTria) < 0)
+        fMinDist = -fMinDist;
     return fMinDist;
 }
+}
+
+float InspectNominalShape::getDistance(const Base::Vector3f& point) const
+{
+    TriangleBVH::Hit hit;
+    bool hasHit = false;
+    FaceSurface surface;
+    return shapeDistance(*_pMesh, _offset, isSolid, point, hit, hasHit, surface);
+}
+
+void InspectNominalShape::getDistances(const std::vector<Base::Vector3f>& points,
+                                       std::vector<float>& distances) const
+{
+    // Reuse the nearest triangle and the surface of the previous point
+    TriangleBVH::Hit hit;
+    bool hasHit = false;
+    FaceSurface surface;
+    distances.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); i++)
+        distances[i] = shapeDistance(*_pMesh, _offset, isSolid, points[i], hit, hasHit, surface);
+}
 
 // ----------------------------------------------------------------
 
@@ -597,8 +1064,6 @@ short Feature::mustExecute() const
 
 App::DocumentObjectExecReturn* Feature::execute(void)
 {
-    bool useMultithreading = true;
-
     App::DocumentObject* pcActual = Actual.getValue();
     if (!pcActual)
         throw Base::ValueError("No actual geometry to inspect specified");
@@ -613,7 +1078,6 @@ App::DocumentObjectExecReturn* Feature::execute(void)
         actual = new InspectActualPoints(pts->Points.getValue());
     }
     else if (pcActual->getTypeId().isDerivedFrom(Part::Feature::getClassTypeId())) {
-        useMultithreading = false;
         Part::Feature* part = static_cast<Part::Feature*>(pcActual);
         actual = new InspectActualShape(part->Shape.getShape());
     }
@@ -635,7 +1099,6 @@ App::DocumentObjectExecReturn* Feature::execute(void)
             nominal = new InspectNominalPoints(pts->Points.getValue(), this->SearchRadius.getValue());
         }
         else if ((*it)->getTypeId().isDerivedFrom(Part::Feature::getClassTypeId())) {
-            useMultithreading = false;
             Part::Feature* part = static_cast<Part::Feature*>(*it);
             nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
         }
@@ -700,64 +1163,65 @@ App::DocumentObjectExecReturn* Feature::execute(void)
         this->Label.getValue(), -this->SearchRadius.getValue(), this->SearchRadius.getValue(), fRMS);
 #else
     unsigned long count = actual->countPoints();
-    std::vector<float> vals(count);
-    std::function<DistanceInspectionRMS(int)> fMap = [&](unsigned int index)
+    std::vector<float> vals(count, FLT_MAX);
+    float radius = this->SearchRadius.getValue();
+
+    // Pass the points in blocks to the nominals, the blocks are processed
+    // concurrently
+    const unsigned long blockSize = 1024;
+    std::vector<unsigned long> blocks;
+    for (unsigned long first = 0; first < count; first += blockSize)
+        blocks.push_back(first);
+
+    std::function<DistanceInspectionRMS(unsigned long)> fMap = [&](unsigned long first)
     {
-        DistanceInspectionRMS res;
-        Base::Vector3f pnt = actual->getPoint(index);
+        unsigned long last = std::min(first + blockSize, count);
+        std::vector<Base::Vector3f> points(last - first);
+        for (unsigned long index = first; index < last; index++)
+            points[index - first] = actual->getPoint(index);
 
-        float fMinDist = FLT_MAX;
+        std::vector<float> distances;
         for (std::vector<InspectNominalGeometry*>::iterator it = inspectNominal.begin(); it != inspectNominal.end(); ++it) {
-            float fDist = (*it)->getDistance(pnt);
-            if (fabs(fDist) < fabs(fMinDist))
-                fMinDist = fDist;
+            (*it)->getDistances(points, distances);
+            for (std::size_t i = 0; i < distances.size(); i++) {
+                if (fabs(distances[i]) < fabs(vals[first + i]))
+                    vals[first + i] = distances[i];
+            }
         }
 
-        if (fMinDist > this->SearchRadius.getValue()) {
-            fMinDist = FLT_MAX;
-        }
-        else if (-fMinDist > this->SearchRadius.getValue()) {
-            fMinDist = -FLT_MAX;
-        }
-        else {
-            res.m_sumsq += fMinDist * fMinDist;
-            res.m_numv++;
+        DistanceInspectionRMS res;
+        for (unsigned long index = first; index < last; index++) {
+            float& fMinDist = vals[index];
+            if (fMinDist > radius) {
+                fMinDist = FLT_MAX;
+            }
+            else if (-fMinDist > radius) {
+                fMinDist = -FLT_MAX;
+            }
+            else {
+                res.m_sumsq += fMinDist * fMinDist;
+                res.m_numv++;
+            }
         }
-
-        vals[index] = fMinDist;
         return res;
     };
 
-    DistanceInspectionRMS res;
-
-    if (useMultithreading) {
-        // Build vector of increasing indices
-        std::vector<unsigned long> index(count);
-        std::iota(index.begin(), index.end(), 0);
-        // Perform map-reduce operation : compute distances and update sum of squares for RMS computation
-        QFuture<DistanceInspectionRMS> future = QtConcurrent::mappedReduced(
-            index, fMap, &DistanceInspectionRMS::operator+=);
-        // Setup progress bar
-        Base::FutureWatcherProgress progress("Inspecting...", actual->countPoints());
-        QFutureWatcher<DistanceInspectionRMS> watcher;
-        QObject::connect(&watcher, SIGNAL(progressValueChanged(int)),
-            &progress, SLOT(progressValueChanged(int)));
-        // Keep UI responsive during computation
-        QEventLoop loop;
-        QObject::connect(&watcher, SIGNAL(finished()), &loop, SLOT(quit()));
-        watcher.setFuture(future);
-        loop.exec();
-        res = future.result();
-    }
-    else {
-        // Single-threaded operation
-        std::stringstream str;
-        str << "Inspecting " << this->Label.getValue() << "...";
-        Base::SequencerLauncher seq(str.str().c_str(), count);
-
-        for (unsigned int i = 0; i < count; i++)
-            res += fMap(i);
-    }
+    // Perform map-reduce operation : compute distances and update sum of squares for RMS computation
+    QFuture<DistanceInspectionRMS> future = QtConcurrent::mappedReduced(
+        blocks, fMap, &DistanceInspectionRMS::operator+=);
+    // Setup progress bar
+    std::stringstream str;
+    str << "Inspecting " << this->Label.getValue() << "...";
+    Base::FutureWatcherProgress progress(str.str().c_str(), blocks.size());
+    QFutureWatcher<DistanceInspectionRMS> watcher;
+    QObject::connect(&watcher, SIGNAL(progressValueChanged(int)),
+        &progress, SLOT(progressValueChanged(int)));
+    // Keep UI responsive during computation
+    QEventLoop loop;
+    QObject::connect(&watcher, SIGNAL(finished()), &loop, SLOT(quit()));
+    watcher.setFuture(future);
+    loop.exec();
+    DistanceInspectionRMS res = future.result();
 
     Base::Console().Message("RMS value for '%s' with search radius [%.4f,%.4f] is: %.4f\n",
         this->Label.getValue(), -this->SearchRadius.getValue(), this->SearchRadius.getValue(), res.getRMS());
@@ -33,7 +33,6 @@
 #include <Mod/Points/App/Points.h>
 
 class TopoDS_Shape;
-class BRepExtrema_DistShapeShape;
 
 namespace MeshCore {
 class MeshKernel;
@@ -47,6 +46,9 @@ namespace Part   { class TopoShape;  }
 namespace Inspection
 {
 
+class TriangleBVH;
+class ShapeTessellation;
+
 /** Delivers the number of points to be checked and returns the appropriate point to an index. */
 class InspectionExport InspectActualGeometry
 {
@@ -95,28 +97,39 @@ private:
     std::vector<Base::Vector3d> points;
 };
 
-/** Calculates the shortest distance of the underlying geometry to a given point. */
+/** Calculates the shortest distance of the underlying geometry to a given point.
+ * Implementations of getDistance() must be reentrant as the points are
+ * processed concurrently.
+ */
 class InspectionExport InspectNominalGeometry
 {
 public:
     InspectNominalGeometry() {}
     virtual ~InspectNominalGeometry() {}
     virtual float getDistance(const Base::Vector3f&) const = 0;
+    /** Calculates the distances of a block of \a points at once.
+     * The default implementation calls getDistance() for each of them, the
+     * mesh and shape nominals start the search of a point at the result of
+     * the previous one. Like getDistance() it must be reentrant as several
+     * blocks are processed concurrently.
+     */
+    virtual void getDistances(const std::vector<Base::Vector3f>& points,
+                              std::vector<float>& distances) const;
 };
 
+/** Uses a bounding volume hierarchy of the facets to find the exact nearest facet. */
 class InspectionExport InspectNominalMesh : public InspectNominalGeometry
 {
 public:
     InspectNominalMesh(const Mesh::MeshObject& rMesh, float offset);
     ~InspectNominalMesh();
     virtual float getDistance(const Base::Vector3f&) const;
+    virtual void getDistances(const std::vector<Base::Vector3f>& points,
+                              std::vector<float>& distances) const;
 
 private:
-    const MeshCore::MeshKernel& _mesh;
-    MeshCore::MeshGrid* _pGrid;
+    TriangleBVH* _pBVH;
     Base::BoundBox3f _box;
-    bool _bApply;
-    Base::Matrix4D _clTrf;
 };
 
 class InspectionExport InspectNominalFastMesh : public InspectNominalGeometry
@@ -147,16 +160,23 @@ private:
     Points::PointsGrid* _pGrid;
 };
 
+/** The nearest face is searched for on a tessellation of the shape and the
+ * distance is then refined by projecting the point onto the surface of
+ * only this face.
+ */
 class InspectionExport InspectNominalShape : public InspectNominalGeometry
 {
 public:
     InspectNominalShape(const TopoDS_Shape&, float offset);
     ~InspectNominalShape();
     virtual float getDistance(const Base::Vector3f&) const;
+    virtual void getDistances(const std::vector<Base::Vector3f>& points,
+                              std::vector<float>& distances) const;
 
 private:
-    BRepExtrema_DistShapeShape* distss;
     const TopoDS_Shape& _rShape;
+    ShapeTessellation* _pMesh;
+    float _offset;
     bool isSolid;
 };
 
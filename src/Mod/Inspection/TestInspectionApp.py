@@ -0,0 +1,72 @@
+#**************************************************************************
+#   Copyright (c) 2026 FreeCAD Project Association                        *
+#                                                                         *
+#   This file is part of the FreeCAD CAx development system.              *
+#                                                                         *
+#   This program is free software; you can redistribute it and/or modify  *
+#   it under the terms of the GNU Lesser General Public License (LGPL)    *
+#   as published by the Free Software Foundation; either version 2 of     *
+#   the License, or (at your option) any later version.                   *
+#   for detail see the LICENCE text file.                                 *
+#                                                                         *
+#   FreeCAD is distributed in the hope that it will be useful,            *
+#   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+#   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+#   GNU Library General Public License for more details.                  *
+#                                                                         *
+#   You should have received a copy of the GNU Library General Public     *
+#   License along with FreeCAD; if not, write to the Free Software        *
+#   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+#   USA                                                                   *
+#**************************************************************************
+
+import FreeCAD, unittest
+import Inspection, Mesh, Part, Points
+
+class InspectionDistanceCases(unittest.TestCase):
+    def setUp(self):
+        self.doc = FreeCAD.newDocument("InspectionTest")
+        # points above and below the top face of a box of size 10 centered
+        # at the origin, more than one block of points is inspected
+        self.offsets = []
+        points = []
+        for i in range(50):
+            for j in range(50):
+                offset = ((i * 50 + j) % 21 - 10) * 0.1
+                self.offsets.append(offset)
+                points.append(FreeCAD.Vector(i * 0.08 - 2, j * 0.08 - 2, 5 + offset))
+        self.actual = self.doc.addObject("Points::Feature", "Points")
+        self.actual.Points = Points.Points(points)
+
+    def inspect(self, nominal, radius):
+        inspection = self.doc.addObject("Inspection::Feature", "Inspection")
+        inspection.Actual = self.actual
+        inspection.Nominals = [nominal]
+        inspection.SearchRadius = radius
+        self.doc.recompute()
+        return inspection.Distances
+
+    def check(self, distances, radius):
+        # points inside the box have a negative distance, also beyond the
+        # search radius
+        self.assertEqual(len(distances), len(self.offsets))
+        for dist, offset in zip(distances, self.offsets):
+            if offset > radius + 1e-5:
+                self.assertGreater(dist, 1e30)
+            elif offset < -radius - 1e-5:
+                self.assertLess(dist, -1e30)
+            elif abs(offset) < radius - 1e-5:
+                self.assertAlmostEqual(dist, offset, places=4)
+
+    def testNominalMesh(self):
+        nominal = self.doc.addObject("Mesh::Feature", "Mesh")
+        nominal.Mesh = Mesh.createBox(10.0, 10.0, 10.0)
+        self.check(self.inspect(nominal, 0.5), 0.5)
+
+    def testNominalShape(self):
+        nominal = self.doc.addObject("Part::Feature", "Shape")
+        nominal.Shape = Part.makeBox(10, 10, 10, FreeCAD.Vector(-5, -5, -5))
+        self.check(self.inspect(nominal, 0.5), 0.5)
+
+    def tearDown(self):
+        FreeCAD.closeDocument(self.doc.Name)
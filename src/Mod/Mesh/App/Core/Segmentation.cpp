@@ -23,8 +23,13 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <atomic>
+#include <set>
 #endif
 
+#include <QThread>
+#include <QtConcurrentMap>
+
 #include "Segmentation.h"
 #include "Algorithm.h"
 #include "Approximation.h"
@@ -44,6 +49,11 @@ void MeshSurfaceSegment::AddFacet(const MeshFacet&)
 {
 }
 
+MeshSurfaceSegment* MeshSurfaceSegment::Clone() const
+{
+    return nullptr;
+}
+
 void MeshSurfaceSegment::AddSegment(const std::vector<FacetIndex>& segm)
 {
     if (segm.size() >= minFacets) {
@@ -104,6 +114,18 @@ void MeshDistancePlanarSegment::AddFacet(const MeshFacet& face)
     fitter->AddPoint(triangle.GetGravityPoint());
 }
 
+MeshSurfaceSegment* MeshDistancePlanarSegment::Clone() const
+{
+    return new MeshDistancePlanarSegment(kernel, minFacets, tolerance);
+}
+
+// --------------------------------------------------------
+
+AbstractSurfaceFit* AbstractSurfaceFit::Clone() const
+{
+    return nullptr;
+}
+
 // --------------------------------------------------------
 
 PlaneSurfaceFit::PlaneSurfaceFit()
@@ -173,6 +195,13 @@ float PlaneSurfaceFit::GetDistanceToSurface(const Base::Vector3f& pnt) const
         return fitter->GetDistanceToPlane(pnt);
 }
 
+AbstractSurfaceFit* PlaneSurfaceFit::Clone() const
+{
+    if (fitter)
+        return new PlaneSurfaceFit();
+    return new PlaneSurfaceFit(basepoint, normal);
+}
+
 std::vector<float> PlaneSurfaceFit::Parameters() const
 {
     Base::Vector3f base = basepoint;
@@ -278,6 +307,13 @@ float CylinderSurfaceFit::GetDistanceToSurface(const Base::Vector3f& pnt) const
     return (dist - radius);
 }
 
+AbstractSurfaceFit* CylinderSurfaceFit::Clone() const
+{
+    if (fitter)
+        return new CylinderSurfaceFit();
+    return new CylinderSurfaceFit(basepoint, axis, radius);
+}
+
 std::vector<float> CylinderSurfaceFit::Parameters() const
 {
     Base::Vector3f base = basepoint;
@@ -375,6 +411,13 @@ float SphereSurfaceFit::GetDistanceToSurface(const Base::Vector3f& pnt) const
     return (dist - radius);
 }
 
+AbstractSurfaceFit* SphereSurfaceFit::Clone() const
+{
+    if (fitter)
+        return new SphereSurfaceFit();
+    return new SphereSurfaceFit(center, radius);
+}
+
 std::vector<float> SphereSurfaceFit::Parameters() const
 {
     Base::Vector3f base = center;
@@ -448,6 +491,14 @@ std::vector<float> MeshDistanceGenericSurfaceFitSegment::Parameters() const
     return fitter->Parameters();
 }
 
+MeshSurfaceSegment* MeshDistanceGenericSurfaceFitSegment::Clone() const
+{
+    AbstractSurfaceFit* fit = fitter->Clone();
+    if (!fit)
+        return nullptr;
+    return new MeshDistanceGenericSurfaceFitSegment(fit, kernel, minFacets, tolerance);
+}
+
 // --------------------------------------------------------
 
 bool MeshCurvaturePlanarSegment::TestFacet (const MeshFacet &rclFacet) const
@@ -539,56 +590,268 @@ bool MeshSurfaceVisitor::Visit (const MeshFacet & face, const MeshFacet &,
 void MeshSegmentAlgorithm::FindSegments(std::vector<MeshSurfaceSegmentPtr>& segm)
 {
     // reset VISIT flags
-    FacetIndex startFacet;
     MeshCore::MeshAlgorithm cAlgo(myKernel);
     cAlgo.ResetFacetFlag(MeshCore::MeshFacet::VISIT);
 
+    std::vector<FacetIndex> resetVisited;
+    for (std::vector<MeshSurfaceSegmentPtr>::iterator it = segm.begin(); it != segm.end(); ++it) {
+        GrowSegments(**it, resetVisited);
+    }
+}
+
+void MeshSegmentAlgorithm::GrowSegments(MeshSurfaceSegment& segm, std::vector<FacetIndex>& resetVisited)
+{
+    FacetIndex startFacet;
+    MeshCore::MeshAlgorithm cAlgo(myKernel);
+
     const MeshCore::MeshFacetArray& rFAry = myKernel.GetFacets();
     MeshCore::MeshFacetArray::_TConstIterator iCur = rFAry.begin();
     MeshCore::MeshFacetArray::_TConstIterator iBeg = rFAry.begin();
     MeshCore::MeshFacetArray::_TConstIterator iEnd = rFAry.end();
 
     // start from the first not visited facet
-    cAlgo.CountFacetFlag(MeshCore::MeshFacet::VISIT);
-    std::vector<FacetIndex> resetVisited;
-
-    for (std::vector<MeshSurfaceSegmentPtr>::iterator it = segm.begin(); it != segm.end(); ++it) {
-        cAlgo.ResetFacetsFlag(resetVisited, MeshCore::MeshFacet::VISIT);
-        resetVisited.clear();
+    cAlgo.ResetFacetsFlag(resetVisited, MeshCore::MeshFacet::VISIT);
+    resetVisited.clear();
+
+    MeshCore::MeshIsNotFlag<MeshCore::MeshFacet> flag;
+    iCur = std::find_if(iBeg, iEnd, [flag](const MeshFacet& f) {
+        return flag(f, MeshFacet::VISIT);
+    });
+    if (iCur < iEnd)
+        startFacet = iCur - iBeg;
+    else
+        startFacet = FACET_INDEX_MAX;
+    while (startFacet != FACET_INDEX_MAX) {
+        // collect all facets of the same geometry
+        std::vector<FacetIndex> indices;
+        segm.Initialize(startFacet);
+        if (segm.TestInitialFacet(startFacet))
+            indices.push_back(startFacet);
+        MeshSurfaceVisitor pv(segm, indices);
+        myKernel.VisitNeighbourFacets(pv, startFacet);
+
+        // add or discard the segment
+        if (indices.size() <= 1) {
+            resetVisited.push_back(startFacet);
+        }
+        else {
+            segm.AddSegment(indices);
+        }
 
-        MeshCore::MeshIsNotFlag<MeshCore::MeshFacet> flag;
-        iCur = std::find_if(iBeg, iEnd, [flag](const MeshFacet& f) {
+        // search for the next start facet
+        iCur = std::find_if(iCur, iEnd, [flag](const MeshFacet& f) {
             return flag(f, MeshFacet::VISIT);
         });
         if (iCur < iEnd)
             startFacet = iCur - iBeg;
         else
             startFacet = FACET_INDEX_MAX;
-        while (startFacet != FACET_INDEX_MAX) {
-            // collect all facets of the same geometry
-            std::vector<FacetIndex> indices;
-            (*it)->Initialize(startFacet);
-            if ((*it)->TestInitialFacet(startFacet))
-                indices.push_back(startFacet);
-            MeshSurfaceVisitor pv(**it, indices);
-            myKernel.VisitNeighbourFacets(pv, startFacet);
-
-            // add or discard the segment
-            if (indices.size() <= 1) {
-                resetVisited.push_back(startFacet);
+    }
+}
+
+namespace {
+
+// A segment that is grown from a single seed facet by one worker thread
+struct GrowingRegion
+{
+    FacetIndex seed = FACET_INDEX_MAX;
+    int id = -1;
+    bool merged = false;
+    std::unique_ptr<MeshSurfaceSegment> segm;
+    std::vector<FacetIndex> indices;
+    // ids of other regions whose facets are adjacent to this region
+    std::set<int> contacts;
+};
+
+}
+
+void MeshSegmentAlgorithm::FindSegmentsConcurrent(std::vector<MeshSurfaceSegmentPtr>& segm, int numThreads)
+{
+    if (numThreads <= 0)
+        numThreads = std::max(1, QThread::idealThreadCount());
+
+    const MeshFacetArray& rFAry = myKernel.GetFacets();
+    const FacetIndex numFacets = rFAry.size();
+    if (numFacets == 0)
+        return;
+
+    // The id of the region that owns a facet or -1 if the facet is free.
+    // This takes over the role of the VISIT flag of the sequential algorithm
+    // because the flags cannot be set safely from several threads.
+    const int freeFacet = -1;
+    std::unique_ptr<std::atomic<int>[]> owner(new std::atomic<int>[numFacets]);
+    for (FacetIndex i = 0; i < numFacets; i++)
+        owner[i].store(freeFacet, std::memory_order_relaxed);
+
+    auto nextFreeFacet = [&](FacetIndex start) {
+        while (start < numFacets && owner[start].load(std::memory_order_relaxed) != freeFacet)
+            start++;
+        return start;
+    };
+
+    auto growRegion = [&](GrowingRegion& region) {
+        int expected = freeFacet;
+        if (!owner[region.seed].compare_exchange_strong(expected, region.id))
+            return; // the seed has been reached by another region
+
+        MeshSurfaceSegment& surf = *region.segm;
+        surf.Initialize(region.seed);
+        if (surf.TestInitialFacet(region.seed))
+            region.indices.push_back(region.seed);
+
+        std::vector<FacetIndex> currentLevel(1, region.seed), nextLevel;
+        while (!currentLevel.empty()) {
+            for (FacetIndex index : currentLevel) {
+                const MeshFacet& face = rFAry[index];
+                for (int i = 0; i < 3; i++) {
+                    FacetIndex nb = face._aulNeighbours[i];
+                    if (nb >= numFacets)
+                        continue; // no neighbour facet
+
+                    int other = owner[nb].load(std::memory_order_relaxed);
+                    if (other == freeFacet) {
+                        if (!surf.TestFacet(rFAry[nb]))
+                            continue;
+                        expected = freeFacet;
+                        if (owner[nb].compare_exchange_strong(expected, region.id)) {
+                            nextLevel.push_back(nb);
+                            region.indices.push_back(nb);
+                            surf.AddFacet(rFAry[nb]);
+                            continue;
+                        }
+                        other = expected;
+                    }
+
+                    if (other != region.id)
+                        region.contacts.insert(other);
+                }
+            }
+
+            currentLevel.swap(nextLevel);
+            nextLevel.clear();
+        }
+    };
+
+    int nextId = 0;
+    std::vector<FacetIndex> resetVisited;
+    for (std::vector<MeshSurfaceSegmentPtr>::iterator it = segm.begin(); it != segm.end(); ++it) {
+        // release the seeds of discarded segments of the previous surface type
+        for (FacetIndex index : resetVisited)
+            owner[index].store(freeFacet, std::memory_order_relaxed);
+        resetVisited.clear();
+
+        std::unique_ptr<MeshSurfaceSegment> probe((*it)->Clone());
+        if (!probe) {
+            // fall back to the sequential algorithm using the VISIT flags
+            MeshCore::MeshAlgorithm cAlgo(myKernel);
+            cAlgo.ResetFacetFlag(MeshCore::MeshFacet::VISIT);
+            for (FacetIndex i = 0; i < numFacets; i++) {
+                if (owner[i].load(std::memory_order_relaxed) != freeFacet)
+                    rFAry[i].SetFlag(MeshFacet::VISIT);
             }
-            else {
-                (*it)->AddSegment(indices);
+
+            GrowSegments(**it, resetVisited);
+
+            int id = nextId++;
+            for (FacetIndex i = 0; i < numFacets; i++) {
+                if (rFAry[i].IsFlag(MeshFacet::VISIT) && owner[i].load(std::memory_order_relaxed) == freeFacet)
+                    owner[i].store(id, std::memory_order_relaxed);
+            }
+            for (FacetIndex index : resetVisited)
+                owner[index].store(id, std::memory_order_relaxed);
+            continue;
+        }
+
+        const std::size_t batchSize = 4 * static_cast<std::size_t>(numThreads);
+        FacetIndex cursor = nextFreeFacet(0);
+        while (cursor < numFacets) {
+            // distribute the seeds over the range of not yet visited facets
+            std::vector<GrowingRegion> regions;
+            regions.reserve(batchSize);
+            const int firstId = nextId;
+            FacetIndex stride = std::max<FacetIndex>(1, (numFacets - cursor) / batchSize);
+            for (FacetIndex index = cursor; index < numFacets && regions.size() < batchSize; index += stride) {
+                index = nextFreeFacet(index);
+                if (index >= numFacets)
+                    break;
+                GrowingRegion region;
+                region.seed = index;
+                region.id = nextId++;
+                region.segm.reset(probe->Clone());
+                regions.push_back(std::move(region));
             }
 
-            // search for the next start facet
-            iCur = std::find_if(iCur, iEnd, [flag](const MeshFacet& f) {
-                return flag(f, MeshFacet::VISIT);
+            QtConcurrent::blockingMap(regions, growRegion);
+
+            // Resolve conflicts of regions that have grown into each other: starting
+            // with the largest region absorb all adjacent regions whose facets lie
+            // on its surface.
+            std::vector<std::size_t> order(regions.size());
+            for (std::size_t i = 0; i < order.size(); i++)
+                order[i] = i;
+            std::stable_sort(order.begin(), order.end(), [&regions](std::size_t a, std::size_t b) {
+                return regions[a].indices.size() > regions[b].indices.size();
             });
-            if (iCur < iEnd)
-                startFacet = iCur - iBeg;
-            else
-                startFacet = FACET_INDEX_MAX;
+
+            auto toRegion = [&](int id) -> GrowingRegion* {
+                if (id < firstId || id >= nextId)
+                    return nullptr; // owned by an earlier batch or surface type
+                return &regions[id - firstId];
+            };
+            for (GrowingRegion& region : regions) {
+                for (int id : region.contacts) {
+                    GrowingRegion* other = toRegion(id);
+                    if (other)
+                        other->contacts.insert(region.id);
+                }
+            }
+
+            for (std::size_t pos : order) {
+                GrowingRegion& region = regions[pos];
+                if (region.merged || region.indices.size() <= 1)
+                    continue;
+
+                std::vector<int> candidates(region.contacts.begin(), region.contacts.end());
+                std::set<int> tested;
+                while (!candidates.empty()) {
+                    int id = candidates.back();
+                    candidates.pop_back();
+                    GrowingRegion* other = toRegion(id);
+                    if (!other || other == &region || other->merged || !tested.insert(id).second)
+                        continue;
+                    if (other->indices.size() <= 1 || other->indices.size() > region.indices.size())
+                        continue;
+
+                    bool accept = true;
+                    for (FacetIndex index : other->indices) {
+                        if (!region.segm->TestFacet(rFAry[index])) {
+                            accept = false;
+                            break;
+                        }
+                    }
+                    if (!accept)
+                        continue;
+
+                    for (FacetIndex index : other->indices) {
+                        region.segm->AddFacet(rFAry[index]);
+                        region.indices.push_back(index);
+                    }
+                    other->merged = true;
+                    candidates.insert(candidates.end(), other->contacts.begin(), other->contacts.end());
+                }
+            }
+
+            // add or discard the segments
+            for (GrowingRegion& region : regions) {
+                if (region.merged || region.id < 0 || owner[region.seed].load(std::memory_order_relaxed) != region.id)
+                    continue;
+                if (region.indices.size() <= 1)
+                    resetVisited.push_back(region.seed);
+                else
+                    (*it)->AddSegment(region.indices);
+            }
+
+            cursor = nextFreeFacet(cursor);
         }
     }
 }
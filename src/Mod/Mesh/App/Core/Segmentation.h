@@ -48,6 +48,13 @@ public:
     virtual void Initialize(FacetIndex);
     virtual bool TestInitialFacet(FacetIndex) const;
     virtual void AddFacet(const MeshFacet& rclFacet);
+    /*!
+     * \brief Clone
+     * Creates a new segment object with the same settings but without any
+     * found segments. This is used to grow several segments concurrently.
+     * Returns null if the segment type doesn't support it.
+     */
+    virtual MeshSurfaceSegment* Clone() const;
     void AddSegment(const std::vector<FacetIndex>&);
     const std::vector<MeshSegment>& GetSegments() const { return segments; }
     MeshSegment FindSegment(FacetIndex) const;
@@ -80,6 +87,7 @@ public:
     const char* GetType() const { return "Plane"; }
     void Initialize(FacetIndex);
     void AddFacet(const MeshFacet& rclFacet);
+    MeshSurfaceSegment* Clone() const;
 
 protected:
     Base::Vector3f basepoint;
@@ -100,6 +108,8 @@ public:
     virtual float Fit() = 0;
     virtual float GetDistanceToSurface(const Base::Vector3f&) const = 0;
     virtual std::vector<float> Parameters() const = 0;
+    /// Returns a new fit object with the same settings, or null if not supported
+    virtual AbstractSurfaceFit* Clone() const;
 };
 
 class MeshExport PlaneSurfaceFit : public AbstractSurfaceFit
@@ -116,6 +126,7 @@ public:
     float Fit();
     float GetDistanceToSurface(const Base::Vector3f&) const;
     std::vector<float> Parameters() const;
+    AbstractSurfaceFit* Clone() const;
 
 private:
     Base::Vector3f basepoint;
@@ -137,6 +148,7 @@ public:
     float Fit();
     float GetDistanceToSurface(const Base::Vector3f&) const;
     std::vector<float> Parameters() const;
+    AbstractSurfaceFit* Clone() const;
 
 private:
     Base::Vector3f basepoint;
@@ -159,6 +171,7 @@ public:
     float Fit();
     float GetDistanceToSurface(const Base::Vector3f&) const;
     std::vector<float> Parameters() const;
+    AbstractSurfaceFit* Clone() const;
 
 private:
     Base::Vector3f center;
@@ -178,6 +191,7 @@ public:
     bool TestInitialFacet(FacetIndex) const;
     void AddFacet(const MeshFacet& rclFacet);
     std::vector<float> Parameters() const;
+    MeshSurfaceSegment* Clone() const;
 
 protected:
     AbstractSurfaceFit* fitter;
@@ -202,6 +216,9 @@ public:
         : MeshCurvatureSurfaceSegment(ci, minFacets), tolerance(tol) {}
     virtual bool TestFacet (const MeshFacet &rclFacet) const;
     virtual const char* GetType() const { return "Plane"; }
+    virtual MeshSurfaceSegment* Clone() const {
+        return new MeshCurvaturePlanarSegment(info, minFacets, tolerance);
+    }
 
 private:
     float tolerance;
@@ -215,6 +232,9 @@ public:
         : MeshCurvatureSurfaceSegment(ci, minFacets), toleranceMin(tolMin), toleranceMax(tolMax) { curvature = curv;}
     virtual bool TestFacet (const MeshFacet &rclFacet) const;
     virtual const char* GetType() const { return "Cylinder"; }
+    virtual MeshSurfaceSegment* Clone() const {
+        return new MeshCurvatureCylindricalSegment(info, minFacets, toleranceMin, toleranceMax, curvature);
+    }
 
 private:
     float curvature;
@@ -229,6 +249,9 @@ public:
         : MeshCurvatureSurfaceSegment(ci, minFacets), tolerance(tol) { curvature = curv;}
     virtual bool TestFacet (const MeshFacet &rclFacet) const;
     virtual const char* GetType() const { return "Sphere"; }
+    virtual MeshSurfaceSegment* Clone() const {
+        return new MeshCurvatureSphericalSegment(info, minFacets, tolerance, curvature);
+    }
 
 private:
     float curvature;
@@ -244,6 +267,9 @@ public:
           toleranceMin(tolMin), toleranceMax(tolMax) {}
     virtual bool TestFacet (const MeshFacet &rclFacet) const;
     virtual const char* GetType() const { return "Freeform"; }
+    virtual MeshSurfaceSegment* Clone() const {
+        return new MeshCurvatureFreeformSegment(info, minFacets, toleranceMin, toleranceMax, c1, c2);
+    }
 
 private:
     float c1, c2;
@@ -271,6 +297,19 @@ class MeshExport MeshSegmentAlgorithm
 public:
     MeshSegmentAlgorithm(const MeshKernel& kernel) : myKernel(kernel) {}
     void FindSegments(std::vector<MeshSurfaceSegmentPtr>&);
+    /*!
+     * \brief FindSegmentsConcurrent
+     * Does the same as FindSegments() but grows the segments of a surface type
+     * from several seed facets at once. Facets are claimed by the first segment
+     * that reaches them and neighbouring segments are merged afterwards if the
+     * surface of one accepts all facets of the other.
+     * Surface types that cannot be cloned are handled sequentially.
+     * \param numThreads the number of threads, 0 chooses it automatically.
+     */
+    void FindSegmentsConcurrent(std::vector<MeshSurfaceSegmentPtr>&, int numThreads = 0);
+
+private:
+    void GrowSegments(MeshSurfaceSegment&, std::vector<FacetIndex>& resetVisited);
 
 private:
     const MeshKernel& myKernel;
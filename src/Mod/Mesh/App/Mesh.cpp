@@ -1924,7 +1924,8 @@ MeshObject* MeshObject::meshFromSegment(const std::vector<FacetIndex>& indices)
 }
 
 std::vector<Segment> MeshObject::getSegmentsOfType(MeshObject::GeometryType type,
-                                                   float dev, unsigned long minFacets) const
+                                                   float dev, unsigned long minFacets,
+                                                   int threads) const
 {
     std::vector<Segment> segm;
     if (this->_kernel.CountFacets() == 0)
@@ -1953,7 +1954,10 @@ std::vector<Segment> MeshObject::getSegmentsOfType(MeshObject::GeometryType type
     if (surf.get()) {
         std::vector<MeshCore::MeshSurfaceSegmentPtr> surfaces;
         surfaces.push_back(surf);
-        finder.FindSegments(surfaces);
+        if (threads == 1)
+            finder.FindSegments(surfaces);
+        else
+            finder.FindSegmentsConcurrent(surfaces, threads);
 
         const std::vector<MeshCore::MeshSegment>& data = surf->GetSegments();
         for (std::vector<MeshCore::MeshSegment>::const_iterator it = data.begin(); it != data.end(); ++it) {
@@ -327,7 +327,12 @@ public:
     const Segment& getSegment(unsigned long) const;
     Segment& getSegment(unsigned long);
     MeshObject* meshFromSegment(const std::vector<FacetIndex>&) const;
-    std::vector<Segment> getSegmentsOfType(GeometryType, float dev, unsigned long minFacets) const;
+    /** Searches for segments of the given type. With \a threads other than 1
+     * the segments are grown concurrently, see MeshCore::MeshSegmentAlgorithm.
+     * The result may then differ from the sequential search.
+     */
+    std::vector<Segment> getSegmentsOfType(GeometryType, float dev, unsigned long minFacets,
+                                           int threads = 1) const;
     //@}
 
     /** @name Primitives */
@@ -270,7 +270,7 @@ void PropertyCurvatureList::Paste(const App::Property &from)
 // ----------------------------------------------------------------------------
 
 PropertyMeshKernel::PropertyMeshKernel()
-  : _meshObject(new MeshObject()), meshPyObject(0)
+  : _meshObject(new MeshObject()), _meshOwners(new Base::Handled()), meshPyObject(0)
 {
     // Note: Normally this property is a member of a document object, i.e. the setValue()
     // method gets called in the constructor of a sublcass of DocumentObject, e.g. Mesh::Feature.
@@ -295,12 +295,16 @@ void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
     Base::Reference<MeshObject> tmp(_meshObject);
     aboutToSetValue();
     _meshObject = mesh;
+    _meshOwners = new Base::Handled();
+    if (meshPyObject)
+        meshPyObject->setTwinPointer(mesh);
     hasSetValue();
 }
 
 void PropertyMeshKernel::setValue(const MeshObject& mesh)
 {
     aboutToSetValue();
+    detach(false);
     *_meshObject = mesh;
     hasSetValue();
 }
@@ -308,6 +312,7 @@ void PropertyMeshKernel::setValue(const MeshObject& mesh)
 void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    detach(false);
     _meshObject->setKernel(mesh);
     hasSetValue();
 }
@@ -315,6 +320,7 @@ void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 {
     aboutToSetValue();
+    detach(false);
     _meshObject->swap(mesh);
     hasSetValue();
 }
@@ -322,10 +328,43 @@ void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 void PropertyMeshKernel::swapMesh(MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    detach(false);
     _meshObject->swap(mesh);
     hasSetValue();
 }
 
+/**
+ * Copy() shares the mesh object with the returned property, e.g. for the
+ * undo/redo stack. Before modifying the mesh object in place it must
+ * therefore be duplicated if another property still shares it. If
+ * \a copyContent is false the caller replaces the whole mesh anyway and only
+ * the placement is kept.
+ */
+void PropertyMeshKernel::detach(bool copyContent)
+{
+    if (_meshOwners.getRefCount() <= 1)
+        return;
+
+    MeshObject* mesh;
+    if (copyContent) {
+        mesh = new MeshObject(*_meshObject);
+    }
+    else {
+        mesh = new MeshObject();
+        mesh->setTransform(_meshObject->getTransform());
+    }
+
+    _meshObject = mesh;
+    _meshOwners = new Base::Handled();
+    if (meshPyObject)
+        meshPyObject->setTwinPointer(mesh);
+}
+
+const void* PropertyMeshKernel::getSharedData() const
+{
+    return static_cast<const MeshObject*>(_meshObject);
+}
+
 const MeshObject& PropertyMeshKernel::getValue(void)const 
 {
     return *_meshObject;
@@ -357,6 +396,7 @@ unsigned int PropertyMeshKernel::getMemSize (void) const
 MeshObject* PropertyMeshKernel::startEditing()
 {
     aboutToSetValue();
+    detach();
     return (MeshObject*)_meshObject;
 }
 
@@ -368,6 +408,7 @@ void PropertyMeshKernel::finishEditing()
 void PropertyMeshKernel::transformGeometry(const Base::Matrix4D &rclMat)
 {
     aboutToSetValue();
+    detach();
     _meshObject->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -375,12 +416,19 @@ void PropertyMeshKernel::transformGeometry(const Base::Matrix4D &rclMat)
 void PropertyMeshKernel::setPointIndices(const std::vector<std::pair<PointIndex, Base::Vector3f> >& inds)
 {
     aboutToSetValue();
+    detach();
     MeshCore::MeshKernel& kernel = _meshObject->getKernel();
     for (std::vector<std::pair<PointIndex, Base::Vector3f> >::const_iterator it = inds.begin(); it != inds.end(); ++it)
         kernel.SetPoint(it->first, it->second);
     hasSetValue();
 }
 
+void PropertyMeshKernel::setTransform(const Base::Matrix4D &rclTrf)
+{
+    detach();
+    _meshObject->setTransform(rclTrf);
+}
+
 PyObject *PropertyMeshKernel::getPyObject(void)
 {
     if (!meshPyObject) {
@@ -446,6 +494,7 @@ void PropertyMeshKernel::Restore(Base::XMLReader &reader)
         kernel.Adopt(points, facets);
 
         aboutToSetValue();
+        detach(false);
         _meshObject->getKernel().Adopt(points, facets);
         hasSetValue();
     } 
@@ -463,23 +512,29 @@ void PropertyMeshKernel::SaveDocFile (Base::Writer &writer) const
 void PropertyMeshKernel::RestoreDocFile(Base::Reader &reader)
 {
     aboutToSetValue();
+    detach(false);
     _meshObject->load(reader);
     hasSetValue();
 }
 
 App::Property *PropertyMeshKernel::Copy(void) const
 {
-    // Note: Copy the content, do NOT reference the same mesh object
+    // Note: Reference the same mesh object, it's copied on the next modification
     PropertyMeshKernel *prop = new PropertyMeshKernel();
-    *(prop->_meshObject) = *(this->_meshObject);
+    prop->_meshObject = this->_meshObject;
+    prop->_meshOwners = this->_meshOwners;
     return prop;
 }
 
 void PropertyMeshKernel::Paste(const App::Property &from)
 {
-    // Note: Copy the content, do NOT reference the same mesh object
-    aboutToSetValue();
     const PropertyMeshKernel& prop = dynamic_cast<const PropertyMeshKernel&>(from);
-    *(this->_meshObject) = *(prop._meshObject);
+
+    // Note: Reference the same mesh object, it's copied on the next modification
+    aboutToSetValue();
+    _meshObject = prop._meshObject;
+    _meshOwners = prop._meshOwners;
+    if (meshPyObject)
+        meshPyObject->setTwinPointer(static_cast<MeshObject*>(_meshObject));
     hasSetValue();
 }
@@ -166,6 +166,8 @@ public:
     /// Transform the real mesh data
     void transformGeometry(const Base::Matrix4D &rclMat);
     void setPointIndices( const std::vector<std::pair<PointIndex, Base::Vector3f> >& );
+    /** Sets the placement of the mesh without notifying a change of the property. */
+    void setTransform(const Base::Matrix4D &rclTrf);
     //@}
 
     /** @name Python interface */
@@ -195,12 +197,22 @@ public:
     void SaveDocFile (Base::Writer &writer) const;
     void RestoreDocFile(Base::Reader &reader);
 
+    /** Returns a copy that shares the mesh object with this property. The
+     * mesh object is only duplicated once either of them gets modified.
+     */
     App::Property *Copy(void) const;
     void Paste(const App::Property &from);
+    const void *getSharedData() const;
     //@}
 
+private:
+    void detach(bool copyContent = true);
+
 private:
     Base::Reference<MeshObject> _meshObject;
+    /// shared by the properties referencing _meshObject, other references
+    /// e.g. of view providers don't require a copy before modifying it
+    Base::Reference<Base::Handled> _meshOwners;
     MeshPy* meshPyObject;
 };
 
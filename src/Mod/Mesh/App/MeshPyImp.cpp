@@ -29,6 +29,7 @@
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
 #include <Base/MatrixPy.h>
+#include <Base/PyBuffer.h>
 #include <Base/Tools.h>
 
 #include "Mesh.h"
@@ -757,6 +758,95 @@ PyObject*  MeshPy::addFacets(PyObject *args)
     return NULL;
 }
 
+PyObject* MeshPy::getTopologyArrays(PyObject *args)
+{
+    if (!PyArg_ParseTuple(args, ""))
+        return NULL;
+
+    PY_TRY {
+        const MeshObject* mesh = getMeshObjectPtr();
+        const MeshCore::MeshPointArray& points = mesh->getKernel().GetPoints();
+        const MeshCore::MeshFacetArray& facets = mesh->getKernel().GetFacets();
+        Base::Matrix4D mat = mesh->getTransform();
+        bool transform = mat != Base::Matrix4D();
+
+        float *pts;
+        Py::Object pyPoints(Base::newArrayBuffer(points.size(), 3, &pts), true);
+        for (const auto &p : points) {
+            if (transform) {
+                Base::Vector3d v = mat * Base::Vector3d(p.x, p.y, p.z);
+                *pts++ = static_cast<float>(v.x);
+                *pts++ = static_cast<float>(v.y);
+                *pts++ = static_cast<float>(v.z);
+            }
+            else {
+                *pts++ = p.x;
+                *pts++ = p.y;
+                *pts++ = p.z;
+            }
+        }
+
+        std::uint32_t *indices;
+        Py::Object pyFacets(Base::newArrayBuffer(facets.size(), 3, &indices), true);
+        for (const auto &f : facets) {
+            *indices++ = static_cast<std::uint32_t>(f._aulPoints[0]);
+            *indices++ = static_cast<std::uint32_t>(f._aulPoints[1]);
+            *indices++ = static_cast<std::uint32_t>(f._aulPoints[2]);
+        }
+        return Py::new_reference_to(Py::TupleN(pyPoints, pyFacets));
+    } PY_CATCH;
+}
+
+PyObject* MeshPy::setTopologyArrays(PyObject *args)
+{
+    PyObject *pyPoints, *pyFacets;
+    if (!PyArg_ParseTuple(args, "OO", &pyPoints, &pyFacets))
+        return NULL;
+
+    PY_TRY {
+        std::vector<double> coords;
+        Base::readArrayBuffer(pyPoints, 3, coords);
+        std::vector<unsigned long> indices;
+        Base::readArrayBuffer(pyFacets, 3, indices);
+
+        MeshObject* mesh = getMeshObjectPtr();
+        // The arrays are in the same coordinate system as returned by
+        // getTopologyArrays(), i.e. with the placement applied
+        Base::Matrix4D mat = mesh->getTransform();
+        bool transform = mat != Base::Matrix4D();
+        if (transform)
+            mat.inverseGauss();
+
+        MeshCore::MeshPointArray points;
+        points.reserve(coords.size() / 3);
+        for (std::size_t i=0; i<coords.size(); i+=3) {
+            Base::Vector3d v(coords[i], coords[i+1], coords[i+2]);
+            if (transform)
+                v = mat * v;
+            points.push_back(Base::Vector3f(static_cast<float>(v.x),
+                                            static_cast<float>(v.y),
+                                            static_cast<float>(v.z)));
+        }
+
+        MeshCore::MeshFacetArray facets;
+        facets.reserve(indices.size() / 3);
+        for (std::size_t i=0; i<indices.size(); i+=3) {
+            if (indices[i] >= points.size()
+                    || indices[i+1] >= points.size()
+                    || indices[i+2] >= points.size())
+                throw Base::IndexError("Point index out of range");
+            facets.push_back(MeshCore::MeshFacet(indices[i], indices[i+1], indices[i+2]));
+        }
+
+        // Swap in the new kernel so that the segments of the old topology
+        // are cleared
+        MeshCore::MeshKernel kernel;
+        kernel.Adopt(points, facets, true);
+        mesh->swap(kernel);
+        Py_Return;
+    } PY_CATCH;
+}
+
 PyObject* MeshPy::removeFacets(PyObject *args)
 {
     PyObject* list;
@@ -2035,7 +2125,8 @@ PyObject*  MeshPy::getSegmentsOfType(PyObject *args)
     char* type;
     float dev;
     unsigned long minFacets=0;
-    if (!PyArg_ParseTuple(args, "sf|k",&type,&dev,&minFacets))
+    int threads=1;
+    if (!PyArg_ParseTuple(args, "sf|ki",&type,&dev,&minFacets,&threads))
         return NULL;
 
     Mesh::MeshObject::GeometryType geoType;
@@ -2055,7 +2146,7 @@ PyObject*  MeshPy::getSegmentsOfType(PyObject *args)
 
     Mesh::MeshObject* mesh = getMeshObjectPtr();
     std::vector<Mesh::Segment> segments = mesh->getSegmentsOfType
-        (geoType, dev, minFacets);
+        (geoType, dev, minFacets, threads);
 
     Py::List s;
     for (std::vector<Mesh::Segment>::iterator it = segments.begin(); it != segments.end(); ++it) {
@@ -2073,7 +2164,8 @@ PyObject*  MeshPy::getSegmentsOfType(PyObject *args)
 PyObject*  MeshPy::getSegmentsByCurvature(PyObject *args)
 {
     PyObject* l;
-    if (!PyArg_ParseTuple(args, "O",&l))
+    int threads=1;
+    if (!PyArg_ParseTuple(args, "O|i",&l,&threads))
         return NULL;
 
     const MeshCore::MeshKernel& kernel = getMeshObjectPtr()->getKernel();
@@ -2093,7 +2185,10 @@ PyObject*  MeshPy::getSegmentsByCurvature(PyObject *args)
         segm.emplace_back(std::make_shared<MeshCore::MeshCurvatureFreeformSegment>(meshCurv.GetCurvature(), num, tol1, tol2, c1, c2));
     }
 
-    finder.FindSegments(segm);
+    if (threads == 1)
+        finder.FindSegments(segm);
+    else
+        finder.FindSegmentsConcurrent(segm, threads);
 
     Py::List list;
     for (std::vector<MeshCore::MeshSurfaceSegmentPtr>::iterator segmIt = segm.begin(); segmIt != segm.end(); ++segmIt) {
@@ -50,6 +50,32 @@ class MeshTopoTestCases(unittest.TestCase):
         planarMeshObject = Mesh.Mesh(self.planarMesh)
         planarMeshObject.collapseFacets(range(18))
 
+    def testTopologyArrays(self):
+        import array
+        planarMeshObject = Mesh.Mesh(self.planarMesh)
+        points, facets = planarMeshObject.getTopologyArrays()
+        self.assertEqual(points.format, 'f')
+        self.assertEqual(points.shape, (planarMeshObject.CountPoints, 3))
+        self.assertEqual(facets.format, 'I')
+        self.assertEqual(facets.shape, (planarMeshObject.CountFacets, 3))
+        topo = planarMeshObject.Topology
+        self.assertEqual([tuple(f) for f in facets.tolist()], topo[1])
+        for p, v in zip(points.tolist(), topo[0]):
+            self.assertAlmostEqual(FreeCAD.Vector(p).distanceToPoint(v), 0.0)
+
+        mesh = Mesh.Mesh()
+        mesh.setTopologyArrays(array.array('d', [0, 0, 0, 1, 0, 0, 0, 1, 0]),
+                               array.array('q', [0, 1, 2]))
+        self.assertEqual(mesh.CountPoints, 3)
+        self.assertEqual(mesh.CountFacets, 1)
+        with self.assertRaises(Exception):
+            mesh.setTopologyArrays(array.array('d', [0, 0, 0]), array.array('q', [0, 1, 2]))
+        mesh.addSegment([0])
+        self.assertEqual(mesh.countSegments(), 1)
+        mesh.setTopologyArrays(points, facets)
+        self.assertEqual(mesh.CountFacets, planarMeshObject.CountFacets)
+        self.assertEqual(mesh.countSegments(), 0)
+
     def testCorruptedFacet(self):
         v = FreeCAD.Vector
         mesh = Mesh.Mesh()
@@ -626,3 +652,79 @@ class MeshSubElement(unittest.TestCase):
 
     def tearDown(self):
         pass
+
+class MeshSegmentCases(unittest.TestCase):
+    def setUp(self):
+        self.mesh = Mesh.createBox(1.0, 1.0, 1.0)
+
+    def segments(self, segments):
+        return sorted(sorted(s) for s in segments)
+
+    def testSegmentsOfType(self):
+        serial = self.mesh.getSegmentsOfType("Plane", 0.001, 2)
+        self.assertEqual(len(serial), 6)
+        for threads in (0, 2, 4):
+            concurrent = self.mesh.getSegmentsOfType("Plane", 0.001, 2, threads)
+            self.assertEqual(self.segments(concurrent), self.segments(serial))
+
+class MeshUndoRedo(unittest.TestCase):
+    def setUp(self):
+        self.doc = FreeCAD.newDocument("MeshUndoRedo")
+        self.doc.UndoMode = 1
+
+    def testUndoRedo(self):
+        feature = self.doc.addObject("Mesh::Feature", "Mesh")
+        box = Mesh.createBox(1.0, 1.0, 1.0)
+        self.doc.openTransaction("Box")
+        feature.Mesh = box
+        self.doc.commitTransaction()
+
+        # several changes in one transaction must all be undone
+        self.doc.openTransaction("Sphere")
+        sphere = Mesh.createSphere(1.0, 10)
+        feature.Mesh = sphere
+        feature.Placement.Base = FreeCAD.Vector(5, 0, 0)
+        cylinder = Mesh.createCylinder(1.0, 2.0, True, 1.0, 10)
+        feature.Mesh = cylinder
+        self.doc.commitTransaction()
+        self.assertEqual(feature.Mesh.CountFacets, cylinder.CountFacets)
+
+        self.doc.undo()
+        self.assertEqual(feature.Mesh.CountPoints, box.CountPoints)
+        self.assertEqual(feature.Mesh.CountFacets, box.CountFacets)
+        self.assertEqual(feature.Placement.Base, FreeCAD.Vector(0, 0, 0))
+        self.assertEqual(box.CountFacets, 12)
+
+        self.doc.redo()
+        self.assertEqual(feature.Mesh.CountPoints, cylinder.CountPoints)
+        self.assertEqual(feature.Mesh.CountFacets, cylinder.CountFacets)
+        self.assertEqual(feature.Placement.Base, FreeCAD.Vector(5, 0, 0))
+
+        self.doc.undo()
+        self.doc.undo()
+        self.assertEqual(feature.Mesh.CountFacets, 0)
+
+    def testNoCopyWithoutUndo(self):
+        feature = self.doc.addObject("Mesh::Feature", "Mesh")
+        feature.Mesh = Mesh.createBox(1.0, 1.0, 1.0)
+        # like a view provider the facet keeps a reference to the mesh object
+        facet = feature.Mesh.Facets[0]
+        self.assertAlmostEqual(facet.Area, 0.5)
+
+        # the mesh isn't shared with an undo copy, so it is modified in place
+        self.doc.UndoMode = 0
+        feature.Mesh = Mesh.createBox(2.0, 2.0, 2.0)
+        self.assertAlmostEqual(facet.Area, 2.0)
+
+        # the undo copy shares the mesh, so it is copied before modifying it
+        self.doc.UndoMode = 1
+        self.doc.openTransaction("Box")
+        feature.Mesh = Mesh.createBox(3.0, 3.0, 3.0)
+        self.doc.commitTransaction()
+        self.assertAlmostEqual(facet.Area, 2.0)
+        self.assertAlmostEqual(feature.Mesh.Facets[0].Area, 4.5)
+        self.doc.undo()
+        self.assertAlmostEqual(feature.Mesh.Facets[0].Area, 2.0)
+
+    def tearDown(self):
+        FreeCAD.closeDocument(self.doc.Name)
@@ -116,6 +116,7 @@
 #endif //_PreComp_
 
 #include <atomic>
+#include <mutex>
 #include <Base/VectorPy.h>
 #include <Mod/Part/App/LinePy.h>
 #include <Mod/Part/App/LineSegmentPy.h>
@@ -456,6 +457,11 @@ void Geometry::deleteExtension(std::string name)
 
 void Geometry::createNewTag()
 {
+    // Geometries are also created concurrently, e.g. when projecting the
+    // external geometry of a sketch
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+
     // Initialize a random number generator, to avoid Valgrind false positives.
     static boost::mt19937 ran;
     static bool seeded = false;
@@ -57,6 +57,8 @@ public:
     bool AuxGroupUniqueLabel;
     bool SplitEllipsoid;
     long ParallelRunThreshold;
+    long ParallelFuseThreshold;
+    bool LazyElementMap;
     double MinimumDeviation;
     double MeshDeviation;
     double MeshAngularDeflection;
@@ -99,6 +101,10 @@ public:
         funcs["SplitEllipsoid"] = &PartParamsP::updateSplitEllipsoid;
         ParallelRunThreshold = handle->GetInt("ParallelRunThreshold", 100);
         funcs["ParallelRunThreshold"] = &PartParamsP::updateParallelRunThreshold;
+        ParallelFuseThreshold = handle->GetInt("ParallelFuseThreshold", 0);
+        funcs["ParallelFuseThreshold"] = &PartParamsP::updateParallelFuseThreshold;
+        LazyElementMap = handle->GetBool("LazyElementMap", false);
+        funcs["LazyElementMap"] = &PartParamsP::updateLazyElementMap;
         MinimumDeviation = handle->GetFloat("MinimumDeviation", 0.05);
         funcs["MinimumDeviation"] = &PartParamsP::updateMinimumDeviation;
         MeshDeviation = handle->GetFloat("MeshDeviation", 0.2);
@@ -190,6 +196,14 @@ public:
         self->ParallelRunThreshold = self->handle->GetInt("ParallelRunThreshold", 100);
     }
     // Auto generated code (Tools/params_utils.py:238)
+    static void updateParallelFuseThreshold(PartParamsP *self) {
+        self->ParallelFuseThreshold = self->handle->GetInt("ParallelFuseThreshold", 0);
+    }
+    // Auto generated code (Tools/params_utils.py:238)
+    static void updateLazyElementMap(PartParamsP *self) {
+        self->LazyElementMap = self->handle->GetBool("LazyElementMap", false);
+    }
+    // Auto generated code (Tools/params_utils.py:238)
     static void updateMinimumDeviation(PartParamsP *self) {
         self->MinimumDeviation = self->handle->GetFloat("MinimumDeviation", 0.05);
     }
@@ -652,6 +666,60 @@ void PartParams::removeParallelRunThreshold() {
     instance()->handle->RemoveInt("ParallelRunThreshold");
 }
 
+// Auto generated code (Tools/params_utils.py:288)
+const char *PartParams::docParallelFuseThreshold() {
+    return "";
+}
+
+// Auto generated code (Tools/params_utils.py:294)
+const long & PartParams::getParallelFuseThreshold() {
+    return instance()->ParallelFuseThreshold;
+}
+
+// Auto generated code (Tools/params_utils.py:300)
+const long & PartParams::defaultParallelFuseThreshold() {
+    const static long def = 0;
+    return def;
+}
+
+// Auto generated code (Tools/params_utils.py:307)
+void PartParams::setParallelFuseThreshold(const long &v) {
+    instance()->handle->SetInt("ParallelFuseThreshold",v);
+    instance()->ParallelFuseThreshold = v;
+}
+
+// Auto generated code (Tools/params_utils.py:314)
+void PartParams::removeParallelFuseThreshold() {
+    instance()->handle->RemoveInt("ParallelFuseThreshold");
+}
+
+// Auto generated code (Tools/params_utils.py:288)
+const char *PartParams::docLazyElementMap() {
+    return "";
+}
+
+// Auto generated code (Tools/params_utils.py:294)
+const bool & PartParams::getLazyElementMap() {
+    return instance()->LazyElementMap;
+}
+
+// Auto generated code (Tools/params_utils.py:300)
+const bool & PartParams::defaultLazyElementMap() {
+    const static bool def = false;
+    return def;
+}
+
+// Auto generated code (Tools/params_utils.py:307)
+void PartParams::setLazyElementMap(const bool &v) {
+    instance()->handle->SetBool("LazyElementMap",v);
+    instance()->LazyElementMap = v;
+}
+
+// Auto generated code (Tools/params_utils.py:314)
+void PartParams::removeLazyElementMap() {
+    instance()->handle->RemoveBool("LazyElementMap");
+}
+
 // Auto generated code (Tools/params_utils.py:288)
 const char *PartParams::docMinimumDeviation() {
     return "";
@@ -228,6 +228,26 @@ public:
     static const char *docParallelRunThreshold();
     //@}
 
+    // Auto generated code (Tools/params_utils.py:122)
+    //@{
+    /// Accessor for parameter ParallelFuseThreshold
+    static const long & getParallelFuseThreshold();
+    static const long & defaultParallelFuseThreshold();
+    static void removeParallelFuseThreshold();
+    static void setParallelFuseThreshold(const long &v);
+    static const char *docParallelFuseThreshold();
+    //@}
+
+    // Auto generated code (Tools/params_utils.py:122)
+    //@{
+    /// Accessor for parameter LazyElementMap
+    static const bool & getLazyElementMap();
+    static const bool & defaultLazyElementMap();
+    static void removeLazyElementMap();
+    static void setLazyElementMap(const bool &v);
+    static const char *docLazyElementMap();
+    //@}
+
     // Auto generated code (Tools/params_utils.py:122)
     //@{
     /// Accessor for parameter MinimumDeviation
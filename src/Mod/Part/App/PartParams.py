@@ -72,6 +72,8 @@ Params = [
     ParamBool("AuxGroupUniqueLabel", False),
     ParamBool("SplitEllipsoid", True),
     ParamInt("ParallelRunThreshold", 100),
+    ParamInt("ParallelFuseThreshold", 0),
+    ParamBool("LazyElementMap", False),
     _MinimumDeviation,
     _MeshDeviation,
     _MeshAngularDeflection,
@@ -63,6 +63,7 @@
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/DocumentObject.h>
+#include <App/DocumentParams.h>
 #include <App/ObjectIdentifier.h>
 #include <App/GeoFeature.h>
 
@@ -246,6 +247,14 @@ unsigned int PropertyPartShape::getMemSize (void) const
     return _Shape.getMemSize();
 }
 
+const void *PropertyPartShape::getSharedData() const
+{
+    // Copy() references the same TopoDS_TShape unless 'ShapePropertyCopy' is set
+    if (_Shape.isNull())
+        return nullptr;
+    return _Shape.getShape().TShape().get();
+}
+
 void PropertyPartShape::getPaths(std::vector<App::ObjectIdentifier> &paths) const
 {
     // The paths below seem to only there for expression completer. They are no
@@ -324,7 +333,10 @@ void PropertyPartShape::Save (Base::Writer &writer) const
         _Shape.Hasher->Save(writer);
     }
     if(version.size()) {
-        if(!toXML && writer.getFileVersion()>1)
+        // The binary element map is only written to a separate file, so use
+        // one for archives as well when it is enabled
+        if(!toXML && (writer.getFileVersion()>1
+                        || App::DocumentParams::getBinaryElementMap()))
             _Shape.setPersistenceFileName(getFileName(".Map").c_str());
         else
             _Shape.setPersistenceFileName(0);
@@ -93,6 +93,7 @@ public:
     virtual App::Property *Copy(void) const override;
     virtual void Paste(const App::Property &from) override;
     virtual unsigned int getMemSize (void) const override;
+    virtual const void *getSharedData() const override;
     //@}
 
     /// Get valid paths for this property; used by auto completer
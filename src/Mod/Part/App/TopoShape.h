@@ -1001,6 +1001,24 @@ public:
     TopoShape &makESHAPE(const TopoDS_Shape &shape, const Mapper &mapper, 
             const std::vector<TopoShape> &sources, const char *op=nullptr);
 
+    /** Delay the element map generation of makESHAPE() in the current thread
+     *
+     * While enabled, makESHAPE() only records the shape history and keeps the
+     * source shapes. The element map is generated on first access, e.g. when
+     * an element name is looked up, or when another shape made from this one
+     * generates its own element map. Shapes whose elements are never
+     * referenced skip the element naming altogether.
+     *
+     * The previous setting is restored when the guard goes out of scope.
+     */
+    class PartExport LazyElementMapGuard {
+    public:
+        LazyElementMapGuard(bool enable=true);
+        ~LazyElementMapGuard();
+    private:
+        bool _prev;
+    };
+
     /** Generalized shape making with mapped element name from shape history
      *
      * @param maker: op code from OpCodes
@@ -2481,6 +2499,8 @@ protected:
                                                     Data::ElementIDRefs &sids);
 
 private:
+    /// Record the shape history for delayed element map generation in makESHAPE()
+    void delayElementMap(const Mapper &mapper, const std::vector<TopoShape> &sources, const char *op);
 
     /** Helper class to ensure synchronization of element map and cache
      *
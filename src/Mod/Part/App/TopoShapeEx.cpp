@@ -185,7 +185,10 @@
 #   include <OSD_Parallel.hxx>
 #endif
 
+#include <QtConcurrentMap>
+
 #include <array>
+#include <cmath>
 #include <deque>
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/iostreams/device/array.hpp>
@@ -193,6 +196,7 @@
 
 #include <Base/Exception.h>
 #include <Base/Console.h>
+#include <Base/Profiler.h>
 #include <Base/Tools.h>
 #include <App/MappedElement.h>
 #include <App/Application.h>
@@ -344,10 +348,42 @@ struct ShapeSources {
     bool expanded = false;
 };
 
+// Shape history and sources recorded by TopoShape::makESHAPE() for delayed
+// element map generation
+struct DelayedElementMap: TopoShape::Mapper {
+    typedef std::unordered_map<TopoDS_Shape, std::vector<TopoDS_Shape>,
+                               ShapeHasher, ShapeHasher> ShapeMap;
+    ShapeMap _generated;
+    ShapeMap _modified;
+
+    TopoDS_Shape shape;
+    std::vector<TopoShape> sources;
+    std::string op;
+    long tag;
+    App::StringHasherRef hasher;
+
+    virtual const std::vector<TopoDS_Shape> &generated(const TopoDS_Shape &s) const override {
+        auto iter = _generated.find(s);
+        if(iter != _generated.end())
+            return iter->second;
+        return _res;
+    }
+
+    virtual const std::vector<TopoDS_Shape> &modified(const TopoDS_Shape &s) const override {
+        auto iter = _modified.find(s);
+        if(iter != _modified.end())
+            return iter->second;
+        return _res;
+    }
+};
+
+static thread_local bool _DelayElementMap;
+
 class TopoShape::Cache: public std::enable_shared_from_this<TopoShape::Cache>
 {
 public:
     ElementMapPtr cachedElementMap;
+    std::shared_ptr<DelayedElementMap> delayedElementMap;
     TopLoc_Location subLocation;
     
     TopoDS_Shape shape;
@@ -580,6 +616,7 @@ Data::ElementMapPtr TopoShape::resetElementMap(Data::ElementMapPtr elementMap)
         INIT_SHAPE_CACHE();
     if (elementMap) {
         _Cache->cachedElementMap = elementMap;
+        _Cache->delayedElementMap.reset();
         _Cache->subLocation.Identity();
         _SubLocation.Identity();
         _ParentCache.reset();
@@ -594,6 +631,14 @@ void TopoShape::flushElementMap() const
         if (this->_Cache->cachedElementMap) {
             const_cast<TopoShape*>(this)->resetElementMap(this->_Cache->cachedElementMap);
         }
+        else if (this->_Cache->delayedElementMap) {
+            auto delayed = this->_Cache->delayedElementMap;
+            LazyElementMapGuard guard(false);
+            TopoShape self(delayed->tag, delayed->hasher);
+            self.makESHAPE(delayed->shape, *delayed, delayed->sources, delayed->op.c_str());
+            this->_Cache->delayedElementMap.reset();
+            const_cast<TopoShape*>(this)->resetElementMap(self.elementMap());
+        }
         else if (this->_ParentCache) {
             TopoShape parent(this->Tag, this->Hasher, this->_ParentCache->shape);
             parent._Cache = _ParentCache;
@@ -639,7 +684,9 @@ bool TopoShape::hasPendingElementMap() const
 {
     return !elementMap(false)
         && this->_Cache
-        && (this->_ParentCache || this->_Cache->cachedElementMap);
+        && (this->_ParentCache
+                || this->_Cache->cachedElementMap
+                || this->_Cache->delayedElementMap);
 }
 
 void TopoShape::operator = (const TopoShape& sh)
@@ -1032,6 +1079,9 @@ void TopoShape::mapSubElement(const TopoShape &other, const char *op, bool force
     if(!canMapElement(other))
         return;
 
+    if (_Cache->delayedElementMap)
+        flushElementMap();
+
     if (!getElementMapSize(false) && this->_Shape.IsPartner(other._Shape)) {
         if (!this->Hasher)
             this->Hasher = other.Hasher;
@@ -1554,6 +1604,7 @@ TopoShape &TopoShape::makEPipeShell( const std::vector<TopoShape> &shapes,
                                      double tolBound,
                                      double tolAngular)
 {
+    FC_PROFILE_ZONE_DETAIL("TopoShape::makEPipeShell", "Part", op);
     if(!op) op = Part::OpCodes::PipeShell;
 
     if(shapes.size()<2)
@@ -1944,6 +1995,7 @@ TopoShape &TopoShape::makELoft(const std::vector<TopoShape> &shapes,
                                Standard_Integer maxDegree,
                                const char *op)
 {
+    FC_PROFILE_ZONE_DETAIL("TopoShape::makELoft", "Part", op);
     if(!op) op = Part::OpCodes::Loft;
 
     // http://opencascade.blogspot.com/2010/01/surface-modeling-part5.html
@@ -1994,6 +2046,7 @@ TopoShape &TopoShape::makELoft(const std::vector<TopoShape> &shapes,
 }
 
 TopoShape &TopoShape::makEPrism(const TopoShape &base, const gp_Vec& vec, const char *op) {
+    FC_PROFILE_ZONE_DETAIL("TopoShape::makEPrism", "Part", op);
     if(!op) op = Part::OpCodes::Extrude;
     if(base.isNull())
         HANDLE_NULL_SHAPE;
@@ -2237,6 +2290,7 @@ TopoShape &TopoShape::makEPrismUntil(const TopoShape &_base,
 TopoShape &TopoShape::makERevolve(const TopoShape &_base, const gp_Ax1& axis,
         double d, const char *face_maker, const char *op)
 {
+    FC_PROFILE_ZONE_DETAIL("TopoShape::makERevolve", "Part", op);
     if(!op) op = Part::OpCodes::Revolve;
 
     TopoShape base(_base);
@@ -2316,6 +2370,7 @@ TopoShape &TopoShape::makEOffset(const TopoShape &shape,
         double offset, double tol, bool intersection, bool selfInter,
         short offsetMode, JoinType join, bool fill, const char *op)
 {
+    FC_PROFILE_ZONE_DETAIL("TopoShape::makEOffset", "Part", op);
     if(!op) op = Part::OpCodes::Offset;
 
 #if OCC_VERSION_HEX < 0x070200
@@ -2751,6 +2806,7 @@ TopoShape &TopoShape::makEThickSolid(const TopoShape &shape,
         const std::vector<TopoShape> &faces, double offset, double tol, bool intersection,
         bool selfInter, short offsetMode, JoinType join, const char *op)
 {
+    FC_PROFILE_ZONE_DETAIL("TopoShape::makEThickSolid", "Part", op);
     if(!op) op = Part::OpCodes::Thicken;
 
     //we do not offer tangent join type
@@ -2802,6 +2858,7 @@ TopoShape &TopoShape::makEWires(const std::vector<TopoShape> &shapes,
                                 bool shared,
                                 TopoShapeMap *output)
 {
+    FC_PROFILE_ZONE_DETAIL("TopoShape::makEWires", "Part", op);
     if(shapes.empty())
         HANDLE_NULL_SHAPE;
     if(shapes.size() == 1)
@@ -3085,6 +3142,7 @@ TopoShape &TopoShape::makEFace(const std::vector<TopoShape> &shapes,
                                const gp_Pln *pln,
                                int minElementNames)
 {
+    FC_PROFILE_ZONE_DETAIL("TopoShape::makEFace", "Part", op);
     if(!maker || !maker[0]) maker = "Part::FaceMakerBullseye";
     std::unique_ptr<FaceMaker> mkFace = FaceMaker::ConstructFromType(maker);
     mkFace->MyHasher = Hasher;
@@ -3146,6 +3204,7 @@ public:
 };
 
 TopoShape &TopoShape::makERefine(const TopoShape &_shape, const char *op, bool silent) {
+    FC_PROFILE_ZONE_DETAIL("TopoShape::makERefine", "Part", op);
     TopoShape shape(_shape);
     if(shape.isNull()) {
         if(!silent)
@@ -3310,9 +3369,221 @@ TopoShape &TopoShape::makEShellFromWires(const std::vector<TopoShape> &wires, bo
     return *this;
 }
 
+#if OCC_VERSION_HEX >= 0x070300
+
+/** Fuse many shapes by fusing groups of nearby shapes
+ *
+ * Shapes are clustered by the centers of their bounding boxes, the clusters
+ * are fused concurrently, and the process repeats with the cluster results
+ * until one shape is left. The mapper chains the histories of all the
+ * rounds, so that the element names are built as if all shapes were fused
+ * in one go.
+ */
+struct MapperFuseTree: Part::TopoShape::Mapper {
+    struct Group {
+        std::vector<TopoDS_Shape> shapes;
+        TopoDS_Shape result;
+        Handle(BRepTools_History) history;
+        bool failed = false;
+        std::string error;
+    };
+    struct Item {
+        TopoDS_Shape shape;
+        gp_Pnt center;
+    };
+
+    // histories of each round, one per fused group
+    std::vector<std::vector<Handle(BRepTools_History)> > rounds;
+
+    struct Images {
+        std::vector<TopoDS_Shape> modified;
+        std::vector<TopoDS_Shape> generated;
+    };
+    mutable std::unordered_map<TopoDS_Shape, Images, ShapeHasher, ShapeHasher> images;
+
+    TopoDS_Shape fuse(const std::vector<TopoShape> &inputs, bool runParallel)
+    {
+        std::vector<Item> items;
+        items.reserve(inputs.size());
+        for (auto &input : inputs)
+            items.push_back(makeItem(input.getShape()));
+
+        // About the square root of the shape count per group keeps both the
+        // group fusions and the final fusion of the group results small.
+        std::size_t groupSize = std::max<std::size_t>(4,
+                static_cast<std::size_t>(std::ceil(std::sqrt(double(items.size())))));
+
+        while (items.size() > 1) {
+            std::vector<Group> groups;
+            cluster(items.begin(), items.end(), groupSize, groups);
+
+            auto fuseGroup = [runParallel](Group &group) {
+                if (group.shapes.size() == 1) {
+                    group.result = group.shapes.front();
+                    return;
+                }
+                try {
+                    TopTools_ListOfShape arguments, tools;
+                    arguments.Append(group.shapes.front());
+                    for (std::size_t i=1; i<group.shapes.size(); ++i)
+                        tools.Append(group.shapes[i]);
+                    BRepAlgoAPI_Fuse mk;
+                    mk.SetRunParallel(runParallel);
+                    // Groups may share sub-shapes, e.g. pattern instances, so
+                    // the inputs must not be touched while fusing concurrently
+                    mk.SetNonDestructive(Standard_True);
+                    mk.SetArguments(arguments);
+                    mk.SetTools(tools);
+                    mk.Build();
+                    if (!mk.IsDone()) {
+                        group.failed = true;
+                        return;
+                    }
+                    group.result = mk.Shape();
+                    group.history = mk.History();
+                } catch (Standard_Failure &e) {
+                    group.failed = true;
+                    if (e.GetMessageString() != NULL)
+                        group.error = e.GetMessageString();
+                }
+            };
+            if (groups.size() > 1)
+                QtConcurrent::blockingMap(groups, fuseGroup);
+            else
+                fuseGroup(groups.front());
+
+            rounds.emplace_back();
+            items.clear();
+            for (auto &group : groups) {
+                if (group.failed)
+                    FC_THROWM(Base::CADKernelError, "Failed to fuse shapes"
+                            << (group.error.empty() ? "" : ": ") << group.error);
+                if (!group.history.IsNull())
+                    rounds.back().push_back(group.history);
+                items.push_back(makeItem(group.result));
+            }
+        }
+        return items.front().shape;
+    }
+
+    static Item makeItem(const TopoDS_Shape &shape)
+    {
+        Item item;
+        item.shape = shape;
+        Bnd_Box bounds;
+        BRepBndLib::Add(shape, bounds);
+        if (!bounds.IsVoid()) {
+            Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+            bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+            item.center.SetCoord((xMin+xMax)/2, (yMin+yMax)/2, (zMin+zMax)/2);
+        }
+        return item;
+    }
+
+    // Split the items at the median along the longest extent of their
+    // centers, until each part fits in a group.
+    static void cluster(std::vector<Item>::iterator begin,
+                        std::vector<Item>::iterator end,
+                        std::size_t groupSize,
+                        std::vector<Group> &groups)
+    {
+        std::size_t count = end - begin;
+        if (count <= groupSize) {
+            groups.emplace_back();
+            for (auto it=begin; it!=end; ++it)
+                groups.back().shapes.push_back(it->shape);
+            return;
+        }
+        Bnd_Box bounds;
+        for (auto it=begin; it!=end; ++it)
+            bounds.Add(it->center);
+        Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+        bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        int axis = 1;
+        if (yMax - yMin > xMax - xMin)
+            axis = 2;
+        if (zMax - zMin > std::max(xMax - xMin, yMax - yMin))
+            axis = 3;
+        auto middle = begin + count/2;
+        std::nth_element(begin, middle, end, [axis](const Item &a, const Item &b) {
+            return a.center.Coord(axis) < b.center.Coord(axis);
+        });
+        cluster(begin, middle, groupSize, groups);
+        cluster(middle, end, groupSize, groups);
+    }
+
+    const Images &getImages(const TopoDS_Shape &s) const
+    {
+        auto it = images.find(s);
+        if (it != images.end())
+            return it->second;
+
+        // Follow the shape through the rounds. A shape that is neither
+        // modified nor removed in a round is carried over as it is.
+        std::vector<std::pair<TopoDS_Shape, bool> > current(1, std::make_pair(s, false));
+        for (auto &histories : rounds) {
+            std::vector<std::pair<TopoDS_Shape, bool> > next;
+            for (auto &v : current) {
+                bool changed = false;
+                for (auto &history : histories) {
+                    if (history->IsRemoved(v.first)) {
+                        changed = true;
+                        break;
+                    }
+                    for (TopTools_ListIteratorOfListOfShape it(history->Modified(v.first)); it.More(); it.Next()) {
+                        changed = true;
+                        next.emplace_back(it.Value(), v.second);
+                    }
+                    for (TopTools_ListIteratorOfListOfShape it(history->Generated(v.first)); it.More(); it.Next())
+                        next.emplace_back(it.Value(), true);
+                }
+                if (!changed)
+                    next.push_back(v);
+            }
+            current = std::move(next);
+        }
+
+        auto &res = images[s];
+        std::unordered_set<TopoDS_Shape, ShapeHasher, ShapeHasher> modifiedSet, generatedSet;
+        for (auto &v : current) {
+            if (v.second) {
+                if (generatedSet.insert(v.first).second)
+                    res.generated.push_back(v.first);
+            } else if (!v.first.IsSame(s) && modifiedSet.insert(v.first).second)
+                res.modified.push_back(v.first);
+        }
+        return res;
+    }
+
+    virtual const std::vector<TopoDS_Shape> &modified(const TopoDS_Shape &s) const override {
+        _res.clear();
+        try {
+            _res = getImages(s).modified;
+        } catch (const Standard_Failure & e) {
+            if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG))
+                FC_WARN("Exception on shape mapper: " << e.GetMessageString());
+        }
+        return _res;
+    }
+
+    virtual const std::vector<TopoDS_Shape> &generated(const TopoDS_Shape &s) const override {
+        _res.clear();
+        try {
+            _res = getImages(s).generated;
+        } catch (const Standard_Failure & e) {
+            if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG))
+                FC_WARN("Exception on shape mapper: " << e.GetMessageString());
+        }
+        return _res;
+    }
+};
+
+#endif
+
 TopoShape &TopoShape::makEBoolean(const char *maker,
         const std::vector<TopoShape> &shapes, const char *op, double tol)
 {
+    FC_PROFILE_ZONE_DETAIL("TopoShape::makEBoolean", "Part", maker);
 #if OCC_VERSION_HEX <= 0x060800
     if (tol > 0.0)
         Standard_Failure::Raise("Fuzzy Booleans are not supported in this version of OCCT");
@@ -3490,6 +3761,30 @@ TopoShape &TopoShape::makEBoolean(const char *maker,
     } else
         FC_THROWM(Base::CADKernelError,"Unknown maker");
 
+# if OCC_VERSION_HEX >= 0x070300
+    if (strcmp(maker, Part::OpCodes::Fuse)==0
+            && tol <= 0.0
+            && PartParams::getParallelFuseThreshold() > 1
+            && (long)inputs.size() >= PartParams::getParallelFuseThreshold())
+    {
+        for(const auto &shape : inputs) {
+            if(shape.isNull())
+                HANDLE_NULL_INPUT;
+        }
+        bool runParallel = PartParams::getParallelRunThreshold() > 0;
+#   if OCC_VERSION_HEX >= 0x070500
+        if (runParallel)
+            OSD_Parallel::SetUseOcctThreads(Standard_True);
+#   endif
+        MapperFuseTree mapper;
+        TopoDS_Shape result = mapper.fuse(inputs, runParallel);
+        makESHAPE(result, mapper, inputs, op);
+        if(buildShell)
+            makEShell();
+        return *this;
+    }
+# endif
+
     TopTools_ListOfShape shapeArguments,shapeTools;
 
     int i=-1;
@@ -3587,6 +3882,8 @@ Data::MappedName TopoShape::setElementComboName(const Data::IndexedName & elemen
 {
     if(names.empty())
         return Data::MappedName();
+    if (_Cache && _Cache->delayedElementMap)
+        flushElementMap();
     std::string _marker;
     if(!marker)
         marker = elementMapPrefix().c_str();
@@ -3755,9 +4052,62 @@ struct NameInfo {
     const char *shapetype;
 };
 
+TopoShape::LazyElementMapGuard::LazyElementMapGuard(bool enable)
+    :_prev(_DelayElementMap)
+{
+    _DelayElementMap = enable;
+}
+
+TopoShape::LazyElementMapGuard::~LazyElementMapGuard()
+{
+    _DelayElementMap = _prev;
+}
+
+void TopoShape::delayElementMap(const Mapper &mapper,
+                                const std::vector<TopoShape> &shapes,
+                                const char *op)
+{
+    auto delayed = std::make_shared<DelayedElementMap>();
+    delayed->shape = getShape();
+    delayed->op = op;
+    delayed->tag = Tag;
+    delayed->hasher = Hasher;
+
+    // Record the same history queries as makESHAPE() does, so that the shape
+    // maker does not have to be kept around.
+    static const std::array<TopAbs_ShapeEnum,3> types =
+        {TopAbs_VERTEX,TopAbs_EDGE,TopAbs_FACE};
+    for(auto &other : shapes) {
+        if(!canMapElement(other))
+            continue;
+        for(auto type : types) {
+            auto &otherMap = other._Cache->getInfo(type);
+            for (int i=1; i<=otherMap.count(); i++) {
+                const auto &otherElement = otherMap.find(other._Shape,i);
+                const auto &modified = mapper.modified(otherElement);
+                if(modified.size())
+                    delayed->_modified[otherElement] = modified;
+                const auto &generated = mapper.generated(otherElement);
+                if(generated.size())
+                    delayed->_generated[otherElement] = generated;
+            }
+        }
+        // mapSubElement() would have picked up the hasher of the sources
+        if(!Hasher)
+            Hasher = other.Hasher;
+    }
+    delayed->sources = shapes;
+
+    // The record is shared with the copies of this shape through the cache,
+    // so do not attach it to a cache that other shapes may already hold.
+    initCache(1);
+    _Cache->delayedElementMap = delayed;
+}
+
 TopoShape &TopoShape::makESHAPE(const TopoDS_Shape &shape, const Mapper &mapper,
         const std::vector<TopoShape> &shapes, const char *op)
 {
+    FC_PROFILE_ZONE_DETAIL("TopoShape::makESHAPE", "Part", op);
     setShape(shape);
     if(shape.IsNull())
         HANDLE_NULL_SHAPE;
@@ -3776,6 +4126,12 @@ TopoShape &TopoShape::makESHAPE(const TopoDS_Shape &shape, const Mapper &mapper,
         FC_WARN("Not all input shapes are mappable");
 
     if(!op) op = Part::OpCodes::Maker;
+
+    if (_DelayElementMap) {
+        delayElementMap(mapper, shapes, op);
+        return *this;
+    }
+
     std::string _op = op;
     _op += '_';
 
@@ -4651,6 +5007,7 @@ TopoShape &TopoShape::makEFillet(const TopoShape &shape,
                                  double defaultRadius,
                                  const char *op)
 {
+    FC_PROFILE_ZONE_DETAIL("TopoShape::makEFillet", "Part", op);
     if(!op) op = Part::OpCodes::Fillet;
     if(shape.isNull())
         HANDLE_NULL_SHAPE;
@@ -4757,6 +5114,7 @@ TopoShape &TopoShape::makEChamfer(const TopoShape &shape,
                                   const std::vector<ChamferInfo> &edgeInfo,
                                   const char *op)
 {
+    FC_PROFILE_ZONE_DETAIL("TopoShape::makEChamfer", "Part", op);
     if(!op) op = Part::OpCodes::Chamfer;
     if(shape.isNull())
         HANDLE_NULL_SHAPE;
@@ -4795,6 +5153,7 @@ TopoShape &TopoShape::makEChamfer(const TopoShape &shape,
 TopoShape &TopoShape::makEGeneralFuse(const std::vector<TopoShape> &_shapes,
         std::vector<std::vector<TopoShape> > &modifies, double tol, const char *op)
 {
+    FC_PROFILE_ZONE_DETAIL("TopoShape::makEGeneralFuse", "Part", op);
 #if OCC_VERSION_HEX < 0x060900
     (void)_shapes;
     (void)modifies;
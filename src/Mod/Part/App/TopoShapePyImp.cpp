@@ -79,6 +79,7 @@
 #include <Base/Matrix.h>
 #include <Base/Rotation.h>
 #include <Base/MatrixPy.h>
+#include <Base/PyBuffer.h>
 #include <Base/Vector3D.h>
 #include <Base/VectorPy.h>
 #include <App/MappedElement.h>
@@ -1978,6 +1979,37 @@ PyObject* TopoShapePy::tessellate(PyObject *args)
     } PY_CATCH_OCC
 }
 
+PyObject* TopoShapePy::tessellateArrays(PyObject *args)
+{
+    PY_TRY {
+        float tolerance;
+        PyObject* ok = Py_False;
+        if (!PyArg_ParseTuple(args, "f|O!",&tolerance,&PyBool_Type,&ok))
+            return 0;
+        std::vector<Base::Vector3d> Points;
+        std::vector<Data::ComplexGeoData::Facet> Facets;
+        if (PyObject_IsTrue(ok))
+            BRepTools::Clean(getTopoShapePtr()->getShape());
+        getTopoShapePtr()->getFaces(Points, Facets,tolerance);
+
+        double *pts;
+        Py::Object pyPoints(Base::newArrayBuffer(Points.size(), 3, &pts), true);
+        for (const auto &p : Points) {
+            *pts++ = p.x;
+            *pts++ = p.y;
+            *pts++ = p.z;
+        }
+        std::uint32_t *indices;
+        Py::Object pyFacets(Base::newArrayBuffer(Facets.size(), 3, &indices), true);
+        for (const auto &f : Facets) {
+            *indices++ = f.I1;
+            *indices++ = f.I2;
+            *indices++ = f.I3;
+        }
+        return Py::new_reference_to(Py::TupleN(pyPoints, pyFacets));
+    } PY_CATCH_OCC
+}
+
 PyObject* TopoShapePy::project(PyObject *args)
 {
     PyObject *obj;
@@ -3138,6 +3170,12 @@ PyObject *TopoShapePy::getElementHistory(PyObject *args) {
     }PY_CATCH_OCC
 }
 
+PyObject *TopoShapePy::hasPendingElementMap(PyObject *args) {
+    if (!PyArg_ParseTuple(args, ""))
+        return 0;
+    return Py::new_reference_to(Py::Boolean(getTopoShapePtr()->hasPendingElementMap()));
+}
+
 struct PyShapeMapper: Part::ShapeMapper {
     bool populate(bool generated, PyObject *pyobj) {
         if(!pyobj || pyobj == Py_None)
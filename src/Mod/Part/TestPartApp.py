@@ -21,6 +21,7 @@
 
 import FreeCAD, unittest, Part
 import copy 
+import os, tempfile, zipfile
 from FreeCAD import Units
 App = FreeCAD
 
@@ -54,9 +55,76 @@ class PartTestCases(unittest.TestCase):
         #self.Doc.addObject("Part::Feature","Face").Shape = result
         #self.assertTrue(isinstance(result.Surface, Part.BSplineSurface))
 
+    def testElementMapPersistence(self):
+        box1 = self.Doc.addObject("Part::Box","Box1")
+        box2 = self.Doc.addObject("Part::Box","Box2")
+        box2.Placement.Base = App.Vector(5,5,5)
+        fuse = self.Doc.addObject("Part::MultiFuse","Fuse")
+        fuse.Shapes = [box1, box2]
+        self.Doc.recompute()
+        elementMap = fuse.Shape.ElementMap
+        self.assertTrue(elementMap)
+
+        param = App.ParamGet("User parameter:BaseApp/Preferences/Document")
+        binary = param.GetBool("BinaryElementMap", False)
+        fileName = os.path.join(tempfile.gettempdir(), "PartElementMap.FCStd")
+        try:
+            for value in (True, False):
+                param.SetBool("BinaryElementMap", value)
+                self.Doc.saveAs(fileName)
+                with zipfile.ZipFile(fileName) as archive:
+                    maps = [name for name in archive.namelist() if name.endswith(".Map.bin")]
+                    if value:
+                        # the binary element map is stored in its own file
+                        self.assertTrue(maps)
+                        for name in maps:
+                            self.assertTrue(archive.read(name).startswith(b"BeginElementMap v2\n"))
+                    else:
+                        self.assertFalse(maps)
+                FreeCAD.closeDocument(self.Doc.Name)
+                self.Doc = FreeCAD.openDocument(fileName)
+                self.assertEqual(self.Doc.Fuse.Shape.ElementMap, elementMap)
+        finally:
+            param.SetBool("BinaryElementMap", binary)
+            if os.path.exists(fileName):
+                os.remove(fileName)
+
+    def testParallelFuse(self):
+        boxes = []
+        for i in range(4):
+            for j in range(4):
+                box = Part.makeBox(10, 10, 10, App.Vector(i*8, j*8, 0))
+                boxes.append(Part.Shape(box))
+        expected = boxes[0].fuse(boxes[1:])
+
+        param = App.ParamGet("User parameter:BaseApp/Preferences/Mod/Part")
+        threshold = param.GetInt("ParallelFuseThreshold", 0)
+        try:
+            param.SetInt("ParallelFuseThreshold", 4)
+            result = boxes[0].fuse(boxes[1:])
+        finally:
+            param.SetInt("ParallelFuseThreshold", threshold)
+        self.assertAlmostEqual(result.Volume, expected.Volume)
+        self.assertEqual(len(result.Solids), 1)
+        self.assertEqual(len(result.Faces), len(expected.Faces))
+        self.assertEqual(len(result.ElementMap), len(expected.ElementMap))
+
+    def testTessellateArrays(self):
+        box = Part.makeBox(10, 10, 10)
+        box.Placement.Base = App.Vector(1, 2, 3)
+        points, facets = box.tessellateArrays(0.1)
+        expected = box.tessellate(0.1)
+        self.assertEqual(points.format, 'd')
+        self.assertEqual(points.shape, (len(expected[0]), 3))
+        self.assertEqual(facets.format, 'I')
+        self.assertEqual(facets.shape, (len(expected[1]), 3))
+        for p, v in zip(points.tolist(), expected[0]):
+            self.assertAlmostEqual(App.Vector(p).distanceToPoint(v), 0.0)
+        self.assertEqual([tuple(f) for f in facets.tolist()], expected[1])
+
     def tearDown(self):
         #closing doc
-        FreeCAD.closeDocument("PartTest")
+        FreeCAD.closeDocument(self.Doc.Name)
         #print ("omit closing document for debugging")
 
 class PartTestBSplineCurve(unittest.TestCase):
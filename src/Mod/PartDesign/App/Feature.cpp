@@ -44,6 +44,7 @@
 #include "Feature.h"
 #include "FeaturePy.h"
 #include "Mod/Part/App/DatumFeature.h"
+#include "Mod/Part/App/PartParams.h"
 
 #include <Base/Console.h>
 
@@ -361,6 +362,10 @@ App::DocumentObjectExecReturn *Feature::recompute(void)
 {
     SuppressedShape.setValue(TopoShape());
 
+    // Element names are generated when first asked for, which for most
+    // features in a long body is never.
+    Part::TopoShape::LazyElementMapGuard guard(Part::PartParams::getLazyElementMap());
+
     if(!Suppress.getValue())
         return Part::Feature::recompute();
 
@@ -59,6 +59,8 @@
 #include <App/MappedElement.h>
 #include <Mod/Part/App/modelRefine.h>
 
+#include <QtConcurrentMap>
+
 FC_LOG_LEVEL_INIT("PartDesign",true,true)
 
 using namespace PartDesign;
@@ -193,6 +195,88 @@ short Transformed::mustExecute() const
     return PartDesign::Feature::mustExecute();
 }
 
+namespace {
+
+// Geometry of one transformed copy of an original shape
+struct PatternInstance {
+    TopoShape shape;
+    bool failed = false;
+    std::string error;
+};
+
+// Copy and transform the geometry of all instances concurrently. Only the
+// element maps of the originals are carried over, the instances are named
+// afterwards by nameInstance(), because naming uses the (not thread safe)
+// string hasher of the document.
+void makeInstances(const std::vector<TopoShape> &originals,
+                   const std::vector<int> &startIndices,
+                   const std::vector<gp_Trsf> &transformations,
+                   bool copy,
+                   std::vector<std::vector<PatternInstance> > &instances)
+{
+    struct Task {
+        const TopoShape *shape;
+        const gp_Trsf *trsf;
+        PatternInstance *instance;
+    };
+    std::vector<Task> tasks;
+
+    instances.clear();
+    instances.resize(originals.size());
+    for (std::size_t i=0; i<originals.size(); ++i) {
+        // Resolve any pending element map here, the workers must not touch
+        // the hasher
+        originals[i].flushElementMap();
+        int start = std::min<int>(startIndices[i], transformations.size());
+        instances[i].resize(transformations.size() - start);
+        for (std::size_t j=0; j<instances[i].size(); ++j)
+            tasks.push_back({&originals[i], &transformations[start+j], &instances[i][j]});
+    }
+
+    auto makeInstance = [copy](Task &task) {
+        try {
+            auto shapeCopy = copy ? task.shape->makECopy() : *task.shape;
+            if (!shapeCopy.isNull())
+                task.instance->shape = shapeCopy.makETransform(*task.trsf);
+        } catch (Standard_Failure &e) {
+            task.instance->failed = true;
+            if (e.GetMessageString() != NULL)
+                task.instance->error = e.GetMessageString();
+        } catch (Base::Exception &e) {
+            task.instance->failed = true;
+            task.instance->error = e.what();
+        } catch (std::exception &e) {
+            task.instance->failed = true;
+            task.instance->error = e.what();
+        }
+    };
+
+    if (tasks.size() > 1)
+        QtConcurrent::blockingMap(tasks, makeInstance);
+    else
+        for (auto &task : tasks)
+            makeInstance(task);
+}
+
+// Same naming as TopoShape::makETransform(trsf, op) on the original shape
+TopoShape nameInstance(const PatternInstance &instance, const char *op)
+{
+    TopoShape res(instance.shape.Tag, instance.shape.Hasher, instance.shape.getShape());
+    res.copyElementMap(instance.shape, op);
+    return res;
+}
+
+App::DocumentObjectExecReturn *instanceError(const PatternInstance &instance, const std::string &sub)
+{
+    std::string msg("Transformation failed ");
+    msg += sub;
+    if (instance.error.size())
+        msg += std::string(": ") + instance.error;
+    return new App::DocumentObjectExecReturn(msg.c_str());
+}
+
+} // anonymous namespace
+
 App::DocumentObjectExecReturn *Transformed::execute(void)
 {
     rejected.clear();
@@ -465,6 +549,9 @@ App::DocumentObjectExecReturn *Transformed::execute(void)
 
     FC_TIME_INIT(t);
 
+    std::vector<std::vector<PatternInstance> > instances;
+    makeInstances(originalShapes, startIndices, transformations, CopyShape.getValue(), instances);
+
     std::vector<std::pair<TopoShape, Type> > addsub;
 
     if (allowMultiSolid() && ParallelTransform.getValue()) {
@@ -578,6 +665,7 @@ App::DocumentObjectExecReturn *Transformed::execute(void)
         auto lastop = Additive;
         for (const TopoShape &shape : originalShapes) {
             auto &sub = originalSubs[i];
+            auto &shapeInstances = instances[i];
             int idx = startIndices[i];
             auto op = operations[i++];
             if (op != lastop) {
@@ -585,15 +673,18 @@ App::DocumentObjectExecReturn *Transformed::execute(void)
                 buildShape();
             }
             std::vector<gp_Trsf>::const_iterator t = transformations.begin() + idx;
-            for (; t != transformations.end(); ++t,++idx) {
+            for (auto instance = shapeInstances.begin(); t != transformations.end(); ++t,++idx,++instance) {
                 ss.str("");
                 if (idx)
                     ss << 'I' << idx;
-                auto shapeCopy = CopyShape.getValue()?shape.makECopy():shape;
-                if (shapeCopy.isNull())
+                if (instance->failed) {
+                    rejected.emplace_back(shape,std::vector<gp_Trsf>(t,t+1));
+                    return instanceError(*instance, sub);
+                }
+                if (instance->shape.isNull())
                     return new App::DocumentObjectExecReturn("Transformed: Linked shape object is empty");
                 try {
-                    shapeCopy = shapeCopy.makETransform(*t, ss.str().c_str());
+                    auto shapeCopy = nameInstance(*instance, ss.str().c_str());
                     if (idx == 0 && canSkipFirst && (_Version.getValue()==0 || !hasOffset)) {
                         // Skip first transformation in case we do not transform the
                         // first instance (i.e. original feature belongs to the same
@@ -635,6 +726,7 @@ App::DocumentObjectExecReturn *Transformed::execute(void)
     int i=0;
     for (TopoShape &shape : originalShapes) {
         auto &sub = originalSubs[i];
+        auto &shapeInstances = instances[i];
         int idx = startIndices[i];
         auto op = operations[i++];
 
@@ -644,9 +736,8 @@ App::DocumentObjectExecReturn *Transformed::execute(void)
         std::vector<TopoDS_Shape> v_transformedShapes;*/
 
         std::vector<gp_Trsf>::const_iterator t = transformations.begin() + idx;
-        for (; t != transformations.end(); ++t,++idx) {
-            auto shapeCopy = CopyShape.getValue()?shape.makECopy():shape;
-            if (shapeCopy.isNull())
+        for (auto instance = shapeInstances.begin(); t != transformations.end(); ++t,++idx,++instance) {
+            if (instance->shape.isNull() && !instance->failed)
                 return new App::DocumentObjectExecReturn("Transformed: Linked shape object is empty");
 
             if (idx == 0 && canSkipFirst && (_Version.getValue()==0 || !hasOffset)) {
@@ -659,8 +750,11 @@ App::DocumentObjectExecReturn *Transformed::execute(void)
                 ss.str("");
                 ss << 'I' << idx;
             }
+            if (instance->failed)
+                return instanceError(*instance, sub);
+            TopoShape shapeCopy;
             try {
-                shapeCopy = shapeCopy.makETransform(*t, ss.str().c_str());
+                shapeCopy = nameInstance(*instance, ss.str().c_str());
             }catch(Standard_Failure &e) {
                 std::string msg("Transformation failed ");
                 msg += sub;
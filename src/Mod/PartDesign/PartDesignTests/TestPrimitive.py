@@ -152,6 +152,40 @@ class TestPrimitive(unittest.TestCase):
         self.Doc.recompute()
         self.assertAlmostEqual(self.Wedge001.Shape.Volume, 1/2.0 * (10*10 - 9*8) * 10)
 
+    def testLazyElementMap(self):
+        self.Body = self.Doc.addObject('PartDesign::Body','Body')
+        self.Box = self.Doc.addObject('PartDesign::AdditiveBox','Box')
+        self.Box.Length = 11
+        self.Box.Width = 11
+        self.Box.Height = 11
+        self.Body.addObject(self.Box)
+        self.Box001 = self.Doc.addObject('PartDesign::SubtractiveBox','Box001')
+        self.Body.addObject(self.Box001)
+        self.Cylinder = self.Doc.addObject('PartDesign::SubtractiveCylinder','Cylinder')
+        self.Cylinder.Radius = 3
+        self.Cylinder.Height = 20
+        self.Cylinder.Placement.Base = FreeCAD.Vector(11, 11, -5)
+        self.Body.addObject(self.Cylinder)
+        self.Doc.recompute()
+        features = [self.Box, self.Box001, self.Cylinder]
+        self.assertFalse(any(feature.Shape.hasPendingElementMap() for feature in features))
+        elementMaps = [feature.Shape.ElementMap for feature in features]
+
+        param = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/Part")
+        lazy = param.GetBool("LazyElementMap", False)
+        try:
+            param.SetBool("LazyElementMap", True)
+            for feature in features:
+                feature.touch()
+            self.Doc.recompute()
+        finally:
+            param.SetBool("LazyElementMap", lazy)
+        # Nothing asked for the names yet, so no map must have been built
+        for feature in features:
+            self.assertTrue(feature.Shape.hasPendingElementMap(), feature.Name)
+        # The delayed element maps must come out the same as the eager ones
+        self.assertEqual([feature.Shape.ElementMap for feature in features], elementMaps)
+
     def tearDown(self):
         #closing doc
         FreeCAD.closeDocument("PartDesignTestPrimitive")
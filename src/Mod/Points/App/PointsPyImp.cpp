@@ -27,6 +27,7 @@
 #include <Base/Builder3D.h>
 #include <Base/VectorPy.h>
 #include <Base/GeometryPyCXX.h>
+#include <Base/PyBuffer.h>
 #include <boost/math/special_functions/fpclassify.hpp>
 
 // inclusion of the generated files (generated out of PointsPy.xml)
@@ -102,6 +103,68 @@ PyObject* PointsPy::read(PyObject * args)
     Py_Return; 
 }
 
+PyObject* PointsPy::getPointArray(PyObject * args)
+{
+    if (!PyArg_ParseTuple(args, ""))
+        return NULL;
+
+    PY_TRY {
+        const PointKernel* kernel = getPointKernelPtr();
+        const std::vector<PointKernel::value_type>& points = kernel->getBasicPoints();
+        Base::Matrix4D mat = kernel->getTransform();
+        bool transform = mat != Base::Matrix4D();
+
+        float *pts;
+        Py::Object array(Base::newArrayBuffer(points.size(), 3, &pts), true);
+        for (const auto &p : points) {
+            if (transform) {
+                Base::Vector3d v = mat * Base::Vector3d(p.x, p.y, p.z);
+                *pts++ = static_cast<float>(v.x);
+                *pts++ = static_cast<float>(v.y);
+                *pts++ = static_cast<float>(v.z);
+            }
+            else {
+                *pts++ = p.x;
+                *pts++ = p.y;
+                *pts++ = p.z;
+            }
+        }
+        return Py::new_reference_to(array);
+    } PY_CATCH;
+}
+
+PyObject* PointsPy::setPointArray(PyObject * args)
+{
+    PyObject *obj;
+    if (!PyArg_ParseTuple(args, "O", &obj))
+        return NULL;
+
+    PY_TRY {
+        std::vector<double> coords;
+        Base::readArrayBuffer(obj, 3, coords);
+
+        PointKernel* kernel = getPointKernelPtr();
+        Base::Matrix4D mat = kernel->getTransform();
+        bool transform = mat != Base::Matrix4D();
+        if (transform)
+            mat.inverseGauss();
+
+        std::vector<PointKernel::value_type> points;
+        points.reserve(coords.size() / 3);
+        for (std::size_t i=0; i<coords.size(); i+=3) {
+            Base::Vector3d v(coords[i], coords[i+1], coords[i+2]);
+            if (transform)
+                v = mat * v;
+            points.emplace_back(static_cast<float>(v.x),
+                                static_cast<float>(v.y),
+                                static_cast<float>(v.z));
+        }
+        kernel->swap(points);
+    } PY_CATCH;
+
+    Py_Return;
+}
+
 PyObject* PointsPy::write(PyObject * args)
 {
     const char* Name;
@@ -42,22 +42,57 @@ using namespace Points;
 TYPESYSTEM_SOURCE(Points::PropertyPointKernel , App::PropertyComplexGeoData)
 
 PropertyPointKernel::PropertyPointKernel()
-    : _cPoints(new PointKernel())
+    : _cPoints(new PointKernel()), _pointsOwners(new Base::Handled()), pointsPyObject(nullptr)
 {
 
 }
 
 PropertyPointKernel::~PropertyPointKernel()
 {
+    if (pointsPyObject)
+        Py_DECREF(pointsPyObject);
 }
 
 void PropertyPointKernel::setValue(const PointKernel& m)
 {
     aboutToSetValue();
+    detach(false);
     *_cPoints = m;
     hasSetValue();
 }
 
+/**
+ * Copy() shares the point kernel with the returned property, e.g. for the
+ * undo/redo stack. Before modifying the kernel in place it must therefore
+ * be duplicated if another property still shares it. If \a copyContent is
+ * false the caller replaces all points anyway.
+ */
+void PropertyPointKernel::detach(bool copyContent)
+{
+    if (_pointsOwners.getRefCount() <= 1)
+        return;
+
+    PointKernel* kernel;
+    if (copyContent) {
+        kernel = new PointKernel(*_cPoints);
+    }
+    else {
+        kernel = new PointKernel();
+        kernel->setTransform(_cPoints->getTransform());
+    }
+
+    _cPoints = kernel;
+    _pointsOwners = new Base::Handled();
+    // the Python wrapper must not keep pointing to the shared kernel
+    if (pointsPyObject)
+        static_cast<PointsPy*>(pointsPyObject)->setTwinPointer(kernel);
+}
+
+const void* PropertyPointKernel::getSharedData() const
+{
+    return static_cast<const PointKernel*>(_cPoints);
+}
+
 const PointKernel& PropertyPointKernel::getValue(void) const 
 {
     return *_cPoints;
@@ -75,9 +110,14 @@ Base::BoundBox3d PropertyPointKernel::getBoundingBox() const
 
 PyObject *PropertyPointKernel::getPyObject(void)
 {
-    PointsPy* points = new PointsPy(&*_cPoints);
-    points->setConst(); // set immutable
-    return points;
+    if (!pointsPyObject) {
+        PointsPy* points = new PointsPy(&*_cPoints);
+        points->setConst(); // set immutable
+        pointsPyObject = points;
+    }
+
+    Py_INCREF(pointsPyObject);
+    return pointsPyObject;
 }
 
 void PropertyPointKernel::setPyObject(PyObject *value)
@@ -102,6 +142,7 @@ void PropertyPointKernel::Save (Base::Writer &writer) const
 void PropertyPointKernel::Restore(Base::XMLReader &reader)
 {
     aboutToSetValue();
+    detach(false);
     _cPoints->Restore(reader);
     hasSetValue();
 }
@@ -120,7 +161,8 @@ void PropertyPointKernel::RestoreDocFile(Base::Reader &reader)
 App::Property *PropertyPointKernel::Copy(void) const 
 {
     PropertyPointKernel* prop = new PropertyPointKernel();
-    (*prop->_cPoints) = (*this->_cPoints);
+    prop->_cPoints = this->_cPoints;
+    prop->_pointsOwners = this->_pointsOwners;
     return prop;
 }
 
@@ -128,7 +170,10 @@ void PropertyPointKernel::Paste(const App::Property &from)
 {
     aboutToSetValue();
     const PropertyPointKernel& prop = dynamic_cast<const PropertyPointKernel&>(from);
-    *(this->_cPoints) = *(prop._cPoints);
+    this->_cPoints = prop._cPoints;
+    this->_pointsOwners = prop._pointsOwners;
+    if (pointsPyObject)
+        static_cast<PointsPy*>(pointsPyObject)->setTwinPointer(static_cast<PointKernel*>(_cPoints));
     hasSetValue();
 }
 
@@ -140,6 +185,7 @@ unsigned int PropertyPointKernel::getMemSize (void) const
 PointKernel* PropertyPointKernel::startEditing()
 {
     aboutToSetValue();
+    detach();
     return static_cast<PointKernel*>(_cPoints);
 }
 
@@ -176,9 +222,16 @@ void PropertyPointKernel::removeIndices( const std::vector<unsigned long>& uIndi
     setValue(kernel);
 }
 
+void PropertyPointKernel::setTransform(const Base::Matrix4D &rclTrf)
+{
+    detach();
+    _cPoints->setTransform(rclTrf);
+}
+
 void PropertyPointKernel::transformGeometry(const Base::Matrix4D &rclMat)
 {
     aboutToSetValue();
+    detach();
     _cPoints->transformGeometry(rclMat);
     hasSetValue();
 }
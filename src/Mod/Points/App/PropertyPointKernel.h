@@ -62,11 +62,15 @@ public:
 
     /** @name Undo/Redo */
     //@{
-    /// returns a new copy of the property (mainly for Undo/Redo and transactions)
+    /** Returns a new copy of the property (mainly for Undo/Redo and transactions)
+     * The copy shares the point kernel which is only duplicated once either
+     * of them gets modified.
+     */
     App::Property *Copy(void) const;
     /// paste the value from the property (mainly for Undo/Redo and transactions)
     void Paste(const App::Property &from);
     unsigned int getMemSize (void) const;
+    const void *getSharedData() const;
     //@}
 
     /** @name Save/restore */
@@ -84,10 +88,19 @@ public:
     /// Transform the real 3d point kernel
     void transformGeometry(const Base::Matrix4D &rclMat);
     void removeIndices( const std::vector<unsigned long>& );
+    /// Sets the placement of the points without notifying a change of the property
+    void setTransform(const Base::Matrix4D &rclTrf);
     //@}
 
+private:
+    void detach(bool copyContent = true);
+
 private:
     Base::Reference<PointKernel> _cPoints;
+    /// shared by the properties referencing _cPoints, other references
+    /// don't require a copy before modifying it
+    Base::Reference<Base::Handled> _pointsOwners;
+    PyObject* pointsPyObject;
 };
 
 } // namespace Points
@@ -0,0 +1,50 @@
+#**************************************************************************
+#   Copyright (c) 2026 FreeCAD Project Association                        *
+#                                                                         *
+#   This file is part of the FreeCAD CAx development system.              *
+#                                                                         *
+#   This program is free software; you can redistribute it and/or modify  *
+#   it under the terms of the GNU Lesser General Public License (LGPL)    *
+#   as published by the Free Software Foundation; either version 2 of     *
+#   the License, or (at your option) any later version.                   *
+#   for detail see the LICENCE text file.                                 *
+#                                                                         *
+#   FreeCAD is distributed in the hope that it will be useful,            *
+#   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+#   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+#   GNU Library General Public License for more details.                  *
+#                                                                         *
+#   You should have received a copy of the GNU Library General Public     *
+#   License along with FreeCAD; if not, write to the Free Software        *
+#   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+#   USA                                                                   *
+#**************************************************************************
+
+
+import FreeCAD, unittest, array
+import Points
+
+class PointsArrayCases(unittest.TestCase):
+    def testPointArray(self):
+        points = Points.Points()
+        points.setPointArray(array.array('d', [0, 0, 0, 1, 2, 3, 4, 5, 6]))
+        self.assertEqual(points.CountPoints, 3)
+        values = points.getPointArray()
+        self.assertEqual(values.format, 'f')
+        self.assertEqual(values.shape, (3, 3))
+        self.assertEqual(values.tolist(), [[0, 0, 0], [1, 2, 3], [4, 5, 6]])
+        with self.assertRaises(Exception):
+            points.setPointArray(array.array('d', [0, 0]))
+        self.assertEqual(points.CountPoints, 3)
+
+    def testPointArrayPlacement(self):
+        # the arrays are in global coordinates, i.e. with the placement applied
+        points = Points.Points()
+        points.Placement = FreeCAD.Placement(FreeCAD.Vector(1, 2, 3), FreeCAD.Rotation())
+        points.setPointArray(array.array('f', [1, 2, 3, 2, 2, 3]))
+        self.assertEqual(points.CountPoints, 2)
+        expected = [FreeCAD.Vector(1, 2, 3), FreeCAD.Vector(2, 2, 3)]
+        for p, v in zip(points.getPointArray().tolist(), expected):
+            self.assertAlmostEqual(FreeCAD.Vector(p).distanceToPoint(v), 0.0, places=5)
+        for p, v in zip(points.Points, expected):
+            self.assertAlmostEqual(p.distanceToPoint(v), 0.0, places=5)
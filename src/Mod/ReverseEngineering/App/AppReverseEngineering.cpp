@@ -115,10 +115,11 @@ public:
             "filterVoxelGrid(dim)."
         );
         add_keyword_method("normalEstimation",&Module::normalEstimation,
-            "normalEstimation(Points,[KSearch=0, SearchRadius=0]) -> Normals\n"
+            "normalEstimation(Points,[KSearch=0, SearchRadius=0, Threads=0]) -> Normals\n"
             "KSearch is an int and used to search the k-nearest neighbours in\n"
             "the k-d tree. Alternatively, SearchRadius (a float) can be used\n"
             "as spatial distance to determine the neighbours of a point\n"
+            "Threads is the number of threads to use, 0 chooses it automatically\n"
             "Example:\n"
             "\n"
             "import ReverseEngineering as Reen\n"
@@ -135,15 +136,19 @@ public:
 #endif
 #if defined(HAVE_PCL_SEGMENTATION)
         add_keyword_method("regionGrowingSegmentation",&Module::regionGrowingSegmentation,
-            "regionGrowingSegmentation()."
+            "regionGrowingSegmentation(Points, KSearch=5, Normals=None, Threads=0).\n"
+            "Threads is the number of threads used for the normal estimation,\n"
+            "0 chooses it automatically."
         );
         add_keyword_method("featureSegmentation",&Module::featureSegmentation,
-            "featureSegmentation()."
+            "featureSegmentation(Points, KSearch=5, Threads=0)."
         );
 #endif
 #if defined(HAVE_PCL_SAMPLE_CONSENSUS)
         add_keyword_method("sampleConsensus",&Module::sampleConsensus,
-            "sampleConsensus()."
+            "sampleConsensus(SacModel, Points, Normals=None, Threads=0).\n"
+            "Threads is the number of threads used to evaluate the model hypotheses,\n"
+            "0 chooses it automatically."
         );
 #endif
         initialize("This module is the ReverseEngineering module."); // register with Python
@@ -636,11 +641,12 @@ Mesh.show(m)
         PyObject *pts;
         int ksearch=0;
         double searchRadius=0;
+        unsigned int threads=0;
 
-        static char* kwds_normals[] = {"Points", "KSearch", "SearchRadius", NULL};
-        if (!PyArg_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|id", kwds_normals,
+        static char* kwds_normals[] = {"Points", "KSearch", "SearchRadius", "Threads", NULL};
+        if (!PyArg_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|idI", kwds_normals,
                                         &(Points::PointsPy::Type), &pts,
-                                        &ksearch, &searchRadius))
+                                        &ksearch, &searchRadius, &threads))
             throw Py::Exception();
 
         Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
@@ -649,6 +655,7 @@ Mesh.show(m)
         NormalEstimation estimate(*points);
         estimate.setKSearch(ksearch);
         estimate.setSearchRadius(searchRadius);
+        estimate.setNumberOfThreads(threads);
         estimate.perform(normals);
 
         Py::List list;
@@ -665,17 +672,19 @@ Mesh.show(m)
         PyObject *pts;
         PyObject *vec = 0;
         int ksearch=5;
+        unsigned int threads=0;
 
-        static char* kwds_segment[] = {"Points", "KSearch", "Normals", NULL};
-        if (!PyArg_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|iO", kwds_segment,
+        static char* kwds_segment[] = {"Points", "KSearch", "Normals", "Threads", NULL};
+        if (!PyArg_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|iOI", kwds_segment,
                                         &(Points::PointsPy::Type), &pts,
-                                        &ksearch, &vec))
+                                        &ksearch, &vec, &threads))
             throw Py::Exception();
 
         Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
 
         std::list<std::vector<int> > clusters;
         RegionGrowing segm(*points, clusters);
+        segm.setNumberOfThreads(threads);
         if (vec) {
             Py::Sequence list(vec);
             std::vector<Base::Vector3f> normals;
@@ -705,16 +714,18 @@ Mesh.show(m)
     {
         PyObject *pts;
         int ksearch=5;
+        unsigned int threads=0;
 
-        static char* kwds_segment[] = {"Points", "KSearch", NULL};
-        if (!PyArg_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|i", kwds_segment,
-                                        &(Points::PointsPy::Type), &pts, &ksearch))
+        static char* kwds_segment[] = {"Points", "KSearch", "Threads", NULL};
+        if (!PyArg_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|iI", kwds_segment,
+                                        &(Points::PointsPy::Type), &pts, &ksearch, &threads))
             throw Py::Exception();
 
         Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
 
         std::list<std::vector<int> > clusters;
         Segmentation segm(*points, clusters);
+        segm.setNumberOfThreads(threads);
         segm.perform(ksearch);
 
         Py::List lists;
@@ -774,10 +785,11 @@ Points.show(np)
         PyObject *pts;
         PyObject *vec = nullptr;
         const char* sacModelType = nullptr;
+        unsigned int threads = 0;
 
-        static char* kwds_sample[] = {"SacModel", "Points", "Normals", NULL};
-        if (!PyArg_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "sO!|O", kwds_sample,
-                                        &sacModelType, &(Points::PointsPy::Type), &pts, &vec))
+        static char* kwds_sample[] = {"SacModel", "Points", "Normals", "Threads", NULL};
+        if (!PyArg_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "sO!|OI", kwds_sample,
+                                        &sacModelType, &(Points::PointsPy::Type), &pts, &vec, &threads))
             throw Py::Exception();
 
         Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
@@ -803,6 +815,7 @@ Points.show(np)
 
         std::vector<float> parameters;
         SampleConsensus sample(sacModel, *points, normals);
+        sample.setNumberOfThreads(threads);
         std::vector<int> model;
         double probability = sample.perform(parameters, model);
 
@@ -35,7 +35,7 @@
 #if defined(HAVE_PCL_SEGMENTATION)
 #include <pcl/search/search.h>
 #include <pcl/search/kdtree.h>
-#include <pcl/features/normal_3d.h>
+#include <pcl/features/normal_3d_omp.h>
 #include <pcl/segmentation/region_growing.h>
 #include <pcl/filters/extract_indices.h>
 
@@ -48,6 +48,7 @@ using pcl::PointCloud;
 RegionGrowing::RegionGrowing(const Points::PointKernel& pts, std::list<std::vector<int> >& clusters)
   : myPoints(pts)
   , myClusters(clusters)
+  , numThreads(0)
 {
 }
 
@@ -63,7 +64,8 @@ void RegionGrowing::perform(int ksearch)
     //normal estimation
     pcl::search::Search<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
     pcl::PointCloud <pcl::Normal>::Ptr normals (new pcl::PointCloud <pcl::Normal>);
-    pcl::NormalEstimation<pcl::PointXYZ, pcl::Normal> normal_estimator;
+    pcl::NormalEstimationOMP<pcl::PointXYZ, pcl::Normal> normal_estimator;
+    normal_estimator.setNumberOfThreads (numThreads);
     normal_estimator.setSearchMethod (tree);
     normal_estimator.setInputCloud (cloud);
     normal_estimator.setKSearch (ksearch);
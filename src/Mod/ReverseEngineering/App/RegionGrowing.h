@@ -36,6 +36,11 @@ class RegionGrowing
 {
 public:
     RegionGrowing(const Points::PointKernel&, std::list<std::vector<int> >&);
+    /** \brief Set the number of threads used for the normal estimation.
+      * \param[in] num the number of threads (0 chooses it automatically)
+      */
+    inline void
+    setNumberOfThreads (unsigned int num) { numThreads = num; }
     /** \brief Set the number of k nearest neighbors to use for the normal estimation.
       * \param[in] k the number of k-nearest neighbors
       */
@@ -48,6 +53,7 @@ public:
 private:
     const Points::PointKernel& myPoints;
     std::list<std::vector<int> >& myClusters;
+    unsigned int numThreads;
 };
 
 } // namespace Reen
@@ -29,6 +29,7 @@
 #include <boost/math/special_functions/fpclassify.hpp>
 
 #if defined(HAVE_PCL_SAMPLE_CONSENSUS)
+#include <pcl/pcl_config.h>
 #include <pcl/point_types.h>
 #include <pcl/features/normal_3d.h>
 #include <pcl/sample_consensus/ransac.h>
@@ -47,6 +48,7 @@ SampleConsensus::SampleConsensus(SacModel sac, const Points::PointKernel& pts, c
   : mySac(sac)
   , myPoints(pts)
   , myNormals(nor)
+  , numThreads(0)
 {
 }
 
@@ -122,6 +124,10 @@ double SampleConsensus::perform(std::vector<float>& parameters, std::vector<int>
 
     pcl::RandomSampleConsensus<pcl::PointXYZ> ransac (model_p);
     ransac.setDistanceThreshold (.01);
+#if PCL_VERSION_COMPARE(>=,1,12,0)
+    // evaluate the hypotheses concurrently
+    ransac.setNumberOfThreads (static_cast<int>(numThreads));
+#endif
     ransac.computeModel();
     ransac.getInliers(model);
     //ransac.getModel (model);
@@ -46,12 +46,19 @@ public:
       SACMODEL_TORUS,
     };
     SampleConsensus(SacModel sac, const Points::PointKernel&, const std::vector<Base::Vector3d>&);
+    /** \brief Set the number of threads used to evaluate the model hypotheses.
+      * \param[in] num the number of threads (0 chooses it automatically)
+      * \note This requires PCL 1.12 or higher and is ignored otherwise.
+      */
+    inline void
+    setNumberOfThreads (unsigned int num) { numThreads = num; }
     double perform(std::vector<float>& parameters, std::vector<int>& model);
 
 private:
     SacModel mySac;
     const Points::PointKernel& myPoints;
     const std::vector<Base::Vector3d>& myNormals;
+    unsigned int numThreads;
 };
 
 } // namespace Reen
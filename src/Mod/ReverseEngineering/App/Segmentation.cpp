@@ -30,7 +30,7 @@
 #if defined(HAVE_PCL_FILTERS)
 #include <pcl/filters/extract_indices.h>
 #include <pcl/filters/passthrough.h>
-#include <pcl/features/normal_3d.h>
+#include <pcl/features/normal_3d_omp.h>
 #endif
 
 #if defined(HAVE_PCL_SAMPLE_CONSENSUS)
@@ -39,6 +39,7 @@
 #endif
 
 #if defined(HAVE_PCL_SEGMENTATION)
+#include <pcl/pcl_config.h>
 #include <pcl/ModelCoefficients.h>
 #include <pcl/io/pcd_io.h>
 #include <pcl/point_types.h>
@@ -58,6 +59,7 @@ using pcl::PointCloud;
 Segmentation::Segmentation(const Points::PointKernel& pts, std::list<std::vector<int> >& clusters)
   : myPoints(pts)
   , myClusters(clusters)
+  , numThreads(0)
 {
 }
 
@@ -65,7 +67,7 @@ void Segmentation::perform(int ksearch)
 {
     // All the objects needed
     pcl::PassThrough<PointXYZ> pass;
-    pcl::NormalEstimation<PointXYZ, pcl::Normal> ne;
+    pcl::NormalEstimationOMP<PointXYZ, pcl::Normal> ne;
     pcl::SACSegmentationFromNormals<PointXYZ, pcl::Normal> seg;
     pcl::ExtractIndices<PointXYZ> extract;
     pcl::ExtractIndices<pcl::Normal> extract_normals;
@@ -96,12 +98,16 @@ void Segmentation::perform(int ksearch)
     pass.filter (*cloud_filtered);
 
     // Estimate point normals
+    ne.setNumberOfThreads (numThreads);
     ne.setSearchMethod (tree);
     ne.setInputCloud (cloud_filtered);
     ne.setKSearch (ksearch);
     ne.compute (*cloud_normals);
 
     // Create the segmentation object for the planar model and set all the parameters
+#if PCL_VERSION_COMPARE(>=,1,12,0)
+    seg.setNumberOfThreads (static_cast<int>(numThreads));
+#endif
     seg.setOptimizeCoefficients (true);
     seg.setModelType (pcl::SACMODEL_NORMAL_PLANE);
     seg.setNormalDistanceWeight (0.1);
@@ -164,6 +170,7 @@ NormalEstimation::NormalEstimation(const Points::PointKernel& pts)
   : myPoints(pts)
   , kSearch(0)
   , searchRadius(0)
+  , numThreads(0)
 {
 }
 
@@ -192,7 +199,8 @@ void NormalEstimation::perform(std::vector<Base::Vector3d>& normals)
     // Estimate point normals
     pcl::PointCloud<pcl::Normal>::Ptr cloud_normals (new pcl::PointCloud<pcl::Normal>);
     pcl::search::KdTree<PointXYZ>::Ptr tree (new pcl::search::KdTree<PointXYZ> ());
-    pcl::NormalEstimation<PointXYZ, pcl::Normal> ne;
+    pcl::NormalEstimationOMP<PointXYZ, pcl::Normal> ne;
+    ne.setNumberOfThreads (numThreads);
     ne.setSearchMethod (tree);
     //ne.setInputCloud (cloud_filtered);
     ne.setInputCloud (cloud);
@@ -36,6 +36,12 @@ class Segmentation
 {
 public:
     Segmentation(const Points::PointKernel&, std::list<std::vector<int> >& clusters);
+    /** \brief Set the number of threads used for the normal estimation and
+      * the evaluation of the model hypotheses.
+      * \param[in] num the number of threads (0 chooses it automatically)
+      */
+    inline void
+    setNumberOfThreads (unsigned int num) { numThreads = num; }
     /** \brief Set the number of k nearest neighbors to use for the normal estimation.
       * \param[in] k the number of k-nearest neighbors
       */
@@ -44,6 +50,7 @@ public:
 private:
     const Points::PointKernel& myPoints;
     std::list<std::vector<int> >& myClusters;
+    unsigned int numThreads;
 };
 
 class NormalEstimation
@@ -66,6 +73,12 @@ public:
         searchRadius = radius;
     }
 
+    /** \brief Set the number of threads used for the normal estimation.
+      * \param[in] num the number of threads (0 chooses it automatically)
+      */
+    inline void
+    setNumberOfThreads (unsigned int num) { numThreads = num; }
+
     /** \brief Perform the normal estimation.
       * \param[out] the estimated normals
       */
@@ -75,6 +88,7 @@ private:
     const Points::PointKernel& myPoints;
     int kSearch;
     double searchRadius;
+    unsigned int numThreads;
 };
 
 } // namespace Reen
@@ -76,6 +76,7 @@ Sketch::Sketch()
   , RecalculateInitialSolutionWhileMovingPoint(false)
   , resolveAfterGeometryUpdated(false)
   , GCSsys(), ConstraintsCounter(0)
+  , isDatumUpdate(false)
   , isInitMove(false), isFine(true), moveStep(0)
   , defaultSolver(GCS::DogLeg)
   , defaultSolverRedundant(GCS::DogLeg)
@@ -123,6 +124,9 @@ void Sketch::clear(void)
     //for (std::vector<Constraint *>::iterator it = NonDrivingConstraints.begin(); it != NonDrivingConstraints.end(); ++it)
     //    if (*it) delete *it;
     Constrs.clear();
+    SetUpConstraints.clear();
+    DirtyParameters.clear();
+    isDatumUpdate = false;
 
     GCSsys.clear();
     isInitMove = false;
@@ -308,6 +312,10 @@ int Sketch::setUpSketch(const std::vector<Part::Geometry *> &GeoList,
 
     calculateDependentParametersElements();
 
+    SetUpConstraints.reserve(ConstraintList.size());
+    for (auto constr : ConstraintList)
+        SetUpConstraints.emplace_back(constr->clone());
+
     if (debugMode==GCS::Minimal || debugMode==GCS::IterationLevel) {
         Base::TimeInfo end_time;
 
@@ -317,6 +325,93 @@ int Sketch::setUpSketch(const std::vector<Part::Geometry *> &GeoList,
     return GCSsys.dofsNumber();
 }
 
+bool Sketch::updateDatums(const std::vector<Part::Geometry *> &GeoList,
+                          const std::vector<Constraint *> &ConstraintList,
+                          int extGeoCount)
+{
+    if (Geoms.empty() || isInitMove
+            || GeoList.size() != Geoms.size()
+            || ConstraintList.size() != SetUpConstraints.size())
+        return false;
+
+    // The solver continues from its own geometry, which must thus be the one given
+    int intGeoCount = int(GeoList.size()) - extGeoCount;
+    for (int i=0; i < int(GeoList.size()); i++) {
+        const Part::Geometry *geo = GeoList[i];
+        const Part::Geometry *solvedGeo = Geoms[i].geo;
+        if (Geoms[i].external != (i >= intGeoCount)
+                || geo->getTypeId() != solvedGeo->getTypeId()
+                || !geo->isSame(*solvedGeo, Precision::Confusion(), Precision::Angular()))
+            return false;
+        if (i < intGeoCount && GeometryFacade::getBlocked(geo) != GeometryFacade::getBlocked(solvedGeo))
+            return false;
+    }
+
+    std::vector<std::pair<int, double *>> changed;
+    auto constrDef = Constrs.begin();
+    for (int i=0; i < int(ConstraintList.size()); i++) {
+        const Constraint *constr = ConstraintList[i];
+        const Constraint *setUpConstr = SetUpConstraints[i].get();
+        if (constr->Type != setUpConstr->Type
+                || constr->AlignmentType != setUpConstr->AlignmentType
+                || constr->First != setUpConstr->First
+                || constr->FirstPos != setUpConstr->FirstPos
+                || constr->Second != setUpConstr->Second
+                || constr->SecondPos != setUpConstr->SecondPos
+                || constr->Third != setUpConstr->Third
+                || constr->ThirdPos != setUpConstr->ThirdPos
+                || constr->isDriving != setUpConstr->isDriving
+                || constr->InternalAlignmentIndex != setUpConstr->InternalAlignmentIndex
+                || constr->isActive != setUpConstr->isActive)
+            return false;
+
+        // same filter as in addConstraints()
+        if (constr->Type == Block || !constr->isActive)
+            continue;
+        if (constrDef == Constrs.end())
+            return false;
+        // the value of a driven constraint is a result of the solver
+        if (constr->isDriving && constr->getValue() != setUpConstr->getValue()) {
+            // for other types the value is not only a datum (e.g. tangency type, Snell's law ratio)
+            switch (constr->Type) {
+            case Distance:
+            case DistanceX:
+            case DistanceY:
+            case Angle:
+            case Radius:
+            case Diameter:
+            case Weight:
+                break;
+            default:
+                return false;
+            }
+            if (!constrDef->value)
+                return false;
+            changed.emplace_back(i, constrDef->value);
+        }
+        ++constrDef;
+    }
+    if (constrDef != Constrs.end())
+        return false;
+
+    constrDef = Constrs.begin();
+    for (int i=0; i < int(ConstraintList.size()); i++) {
+        const Constraint *constr = ConstraintList[i];
+        if (constr->Type == Block || !constr->isActive)
+            continue;
+        // the constraint objects may have been replaced by copies
+        constrDef->constr = const_cast<Constraint *>(constr);
+        ++constrDef;
+    }
+    for (auto &v : changed) {
+        *v.second = ConstraintList[v.first]->getValue();
+        DirtyParameters.insert(v.second);
+        SetUpConstraints[v.first].reset(ConstraintList[v.first]->clone());
+    }
+    isDatumUpdate = true;
+    return true;
+}
+
 void Sketch::fixParametersAndDiagnose(std::vector<double *> &params_to_block)
 {
     if(params_to_block.size() > 0) { // only there are parameters to fix
@@ -3540,6 +3635,9 @@ int Sketch::solve(void)
 
     auto result = internalSolve(solvername);
 
+    isDatumUpdate = false;
+    DirtyParameters.clear();
+
     Base::TimeInfo end_time;
 
     if(debugMode==GCS::Minimal || debugMode==GCS::IterationLevel){
@@ -3563,6 +3661,14 @@ int Sketch::internalSolve(std::string & solvername, int level)
     bool valid_solution;
     int defaultsoltype = -1;
 
+    // after updateDatums() only the parts depending on the changed datums are solved,
+    // the fall back solvers below still solve the whole sketch
+    auto solveSystem = [this](GCS::Algorithm alg) {
+        if (isDatumUpdate)
+            return GCSsys.solveAffected(DirtyParameters, isFine, alg);
+        return GCSsys.solve(isFine, alg);
+    };
+
     if(isInitMove){
         solvername = "DogLeg"; // DogLeg is used for dragging (same as before)
         ret = GCSsys.solve(isFine, GCS::DogLeg);
@@ -3571,17 +3677,17 @@ int Sketch::internalSolve(std::string & solvername, int level)
         switch (defaultSolver) {
             case 0:
                 solvername = "BFGS";
-                ret = GCSsys.solve(isFine, GCS::BFGS);
+                ret = solveSystem(GCS::BFGS);
                 defaultsoltype=2;
                 break;
             case 1: // solving with the LevenbergMarquardt solver
                 solvername = "LevenbergMarquardt";
-                ret = GCSsys.solve(isFine, GCS::LevenbergMarquardt);
+                ret = solveSystem(GCS::LevenbergMarquardt);
                 defaultsoltype=1;
                 break;
             case 2: // solving with the BFGS solver
                 solvername = "DogLeg";
-                ret = GCSsys.solve(isFine, GCS::DogLeg);
+                ret = solveSystem(GCS::DogLeg);
                 defaultsoltype=0;
                 break;
         }
@@ -72,6 +72,20 @@ public:
       */
     int setUpSketch(const std::vector<Part::Geometry *> &GeoList, const std::vector<Constraint *> &ConstraintList,
                     int extGeoCount=0);
+    /** update the datums of the set up sketch
+      *
+      * If the geometry is the one of the last solve and the constraints only
+      * differ from the ones the sketch was set up with in the values of driving
+      * dimensional constraints, the new values are passed to the existing solver
+      * system. The next solve() then only solves the parts of the sketch that
+      * depend on the changed values. The degrees of freedom and the diagnosis
+      * of the set up sketch are kept.
+      *
+      * returns false if anything else changed, in which case the sketch needs
+      * to be set up again with setUpSketch()
+      */
+    bool updateDatums(const std::vector<Part::Geometry *> &GeoList, const std::vector<Constraint *> &ConstraintList,
+                      int extGeoCount=0);
     /// return the actual geometry of the sketch a TopoShape
     Part::TopoShape toShape(void) const;
     /// add unspecified geometry
@@ -428,6 +442,9 @@ protected:
 
     std::vector<GeoDef> Geoms;
     std::vector<ConstrDef> Constrs;
+    std::vector<std::unique_ptr<Constraint>> SetUpConstraints; // copy of the constraints the sketch was set up with
+    GCS::SET_pD DirtyParameters; // datum parameters changed by updateDatums()
+    bool isDatumUpdate;          // only solve the parts of the sketch depending on DirtyParameters
     GCS::System GCSsys;
     int ConstraintsCounter;
     std::vector<int> Conflicting;
@@ -476,6 +493,8 @@ public:
     inline void setConvergenceRedundant(double conv){GCSsys.convergenceRedundant=conv;}
     inline void setQRAlgorithm(GCS::QRAlgorithm alg){GCSsys.qrAlgorithm=alg;}
     inline GCS::QRAlgorithm getQRAlgorithm(){return GCSsys.qrAlgorithm;}
+    inline void setJacobianType(GCS::JacobianType type){GCSsys.jacobianType=type;}
+    inline GCS::JacobianType getJacobianType(){return GCSsys.jacobianType;}
     inline void setQRPivotThreshold(double val){GCSsys.qrpivotThreshold=val;}
     inline void setLM_eps(double val){GCSsys.LM_eps=val;}
     inline void setLM_eps1(double val){GCSsys.LM_eps1=val;}
@@ -110,6 +110,8 @@
 #include <Mod/Sketcher/App/SolverGeometryExtension.h>
 #include <Mod/Sketcher/App/ExternalGeometryFacade.h>
 
+#include <QtConcurrentMap>
+
 #include "SketchObject.h"
 
 
@@ -449,11 +451,26 @@ int SketchObject::solve(bool updateGeoAfterSolving/*=true*/)
     // We should have an updated Sketcher (sketchobject) geometry or this solve() should not have happened
     // therefore we update our sketch solver geometry with the SketchObject one.
     //
-    // set up a sketch (including dofs counting and diagnosing of conflicts)
-    lastDoF = solvedSketch.setUpSketch(getCompleteGeometry(), Constraints.getValues(),
-                                  getExternalGeometryCount());
+    // If only datums changed since the last successful solve of a sane sketch (e.g. setDatum()), the
+    // solver system is kept and only the parts of the sketch depending on the datums are solved again.
+    // Otherwise the sketch is set up anew.
+    bool datumUpdate = !solverNeedsUpdate
+                       && lastSolverStatus == GCS::Success
+                       && lastDoF >= 0
+                       && !lastHasConflict
+                       && !lastHasRedundancies
+                       && !lastHasPartialRedundancies
+                       && !lastHasMalformedConstraints
+                       && solvedSketch.updateDatums(getCompleteGeometry(), Constraints.getValues(),
+                                                    getExternalGeometryCount());
+
+    if (!datumUpdate) {
+        // set up a sketch (including dofs counting and diagnosing of conflicts)
+        lastDoF = solvedSketch.setUpSketch(getCompleteGeometry(), Constraints.getValues(),
+                                      getExternalGeometryCount());
 
-    FullyConstrained.setValue(lastDoF == 0);
+        FullyConstrained.setValue(lastDoF == 0);
+    }
     // At this point we have the solver information about conflicting/redundant/over-constrained, but the sketch is NOT solved.
     // Some examples:
     // Redundant: a vertical line, a horizontal line and an angle constraint of 90 degrees between the two lines
@@ -490,6 +507,11 @@ int SketchObject::solve(bool updateGeoAfterSolving/*=true*/)
     else {
         lastSolverStatus=solvedSketch.solve();
         if (lastSolverStatus != 0){ // solving
+            if (datumUpdate) {
+                // the new datums may need a fresh diagnosis, fall back to setting up the sketch
+                solverNeedsUpdate=true;
+                return solve(updateGeoAfterSolving);
+            }
             err = -1;
         }
     }
@@ -7527,6 +7549,39 @@ static Part::Geometry *fitArcs(std::vector<std::unique_ptr<Part::Geometry> > &ar
     }
 }
 
+namespace {
+
+// Projection of one external reference
+struct ProjectionTask {
+    struct Message {
+        bool error;
+        std::string text;
+        std::string detail;
+    };
+
+    int index = 0;
+    std::string key;
+    TopoDS_Shape shape;
+    bool intersection = false;
+    bool cached = false;
+    bool failed = false;
+    std::vector<std::unique_ptr<Part::Geometry> > geos;
+    std::vector<Message> messages;
+
+    void warn(const char *text, const std::string &detail = std::string()) {
+        messages.push_back({false, text, detail});
+    }
+    void error(const char *text, const std::string &detail = std::string()) {
+        messages.push_back({true, text, detail});
+    }
+    void fail(const char *msg) {
+        failed = true;
+        error("Failed to project external geometry in", std::string("\n") + (msg ? msg : ""));
+    }
+};
+
+} // anonymous namespace
+
 void SketchObject::rebuildExternalGeometry(bool defining, bool addIntersection)
 {
     Base::StateLocker lock(managedoperation, true); // no need to check input data validity as this is an sketchobject managed operation.
@@ -7597,6 +7652,22 @@ void SketchObject::rebuildExternalGeometry(bool defining, bool addIntersection)
     std::vector<std::vector<std::unique_ptr<Part::Geometry> > > newGeos;
     newGeos.reserve(Objects.size());
 
+    // The projections are only valid for the same sketch placement and settings
+    std::vector<double> projectionSettings = {
+        ArcFitTolerance.getValue(),
+        double(ExternalBSplineMaxDegree.getValue()),
+        ExternalBSplineTolerance.getValue()
+    };
+    if (!(externalProjectionPlacement == Plm) || externalProjectionSettings != projectionSettings) {
+        externalProjections.clear();
+        externalProjectionPlacement = Plm;
+        externalProjectionSettings = std::move(projectionSettings);
+    }
+
+    // Resolve the references first, as that may not be done concurrently
+    std::vector<ProjectionTask> tasks;
+    tasks.reserve(Objects.size());
+
     for (int i=0; i < int(Objects.size()); i++) {
         const App::DocumentObject *Obj=Objects[i];
         const std::string &SubElement=SubElements[i];
@@ -7626,10 +7697,8 @@ void SketchObject::rebuildExternalGeometry(bool defining, bool addIntersection)
         if(!Obj || !Obj->getNameInDocument())
             continue;
 
-        std::vector<std::unique_ptr<Part::Geometry> > geos;
-
+        TopoDS_Shape refSubShape;
         try {
-            TopoDS_Shape refSubShape;
             if (Obj->getTypeId().isDerivedFrom(App::Plane::getClassTypeId())) {
                 const App::Plane* pl = static_cast<const App::Plane*>(Obj);
                 Base::Placement plm = pl->Placement.getValue();
@@ -7646,12 +7715,55 @@ void SketchObject::rebuildExternalGeometry(bool defining, bool addIntersection)
             } else {
                 refSubShape = Part::Feature::getShape(Obj,SubElement.c_str(),true);
             }
+        } catch (Base::Exception &e) {
+            FC_ERR("Failed to project external geometry in "
+                   << getFullName() << ": " << key << std::endl << e.what());
+            continue;
+        } catch (Standard_Failure &e) {
+            FC_ERR("Failed to project external geometry in "
+                   << getFullName() << ": " << key << std::endl << e.GetMessageString());
+            continue;
+        } catch (std::exception &e) {
+            FC_ERR("Failed to project external geometry in "
+                   << getFullName() << ": " << key << std::endl << e.what());
+            continue;
+        } catch (...) {
+            FC_ERR("Failed to project external geometry in "
+                   << getFullName() << ": " << key << std::endl << "Unknown exception");
+            continue;
+        }
 
-            if(refSubShape.IsNull()) {
-                FC_WARN("Null shape from geometry reference in " << getFullName() << ": " << key);
-                continue;
-            }
+        if(refSubShape.IsNull()) {
+            FC_WARN("Null shape from geometry reference in " << getFullName() << ": " << key);
+            continue;
+        }
+
+        tasks.emplace_back();
+        ProjectionTask &task = tasks.back();
+        task.index = i;
+        task.key = key;
+        task.shape = refSubShape;
+        task.intersection = intersection;
+
+        // Reuse the last projection if the referenced shape did not change
+        auto cached = externalProjections.find(key);
+        if (cached != externalProjections.end()
+                && cached->second.intersection == intersection
+                && cached->second.shape.IsEqual(refSubShape))
+        {
+            task.cached = true;
+            for (auto &geo : cached->second.geos)
+                task.geos.emplace_back(geo->clone());
+        }
+    }
 
+    // Project the references. Only the properties of this sketch are read
+    // here, messages are reported afterwards.
+    auto project = [&](ProjectionTask &task) {
+        auto &geos = task.geos;
+        const TopoDS_Shape &refSubShape = task.shape;
+        bool intersection = task.intersection;
+        try {
             auto importFace = [&](const TopoDS_Shape &refSubShape) {
                 gp_Pln plane;
                 if (Part::TopoShape(refSubShape).findPlane(plane)) {
@@ -7672,12 +7784,10 @@ void SketchObject::rebuildExternalGeometry(bool defining, bool addIntersection)
                         }
 
                     } else {
-                        FC_WARN("Skip external reference plane that is not normal to sketch plane in "
-                                << getFullName() << ": " << key);
+                        task.warn("Skip external reference plane that is not normal to sketch plane in");
                     }
                 } else {
-                    FC_WARN("Skip non-planar external reference face in sketch "
-                                << getFullName() << ": " << key);
+                    task.warn("Skip non-planar external reference face in sketch");
                 }
             };
 
@@ -7945,7 +8055,7 @@ void SketchObject::rebuildExternalGeometry(bool defining, bool addIntersection)
                         mkProj.Build();
                         projShape.setShape(mkProj.Projection());
                         if (projShape.isNull() || !projShape.hasSubShape(TopAbs_EDGE)) {
-                            FC_ERR("Invalid geometry in sketch " << getFullName() << ": " << key);
+                            task.error("Invalid geometry in sketch");
                             return;
                         }
                     }
@@ -8047,8 +8157,7 @@ void SketchObject::rebuildExternalGeometry(bool defining, bool addIntersection)
                                             err = e.what();
                                         }
                                         if (err.size())
-                                            FC_WARN("Failed to simplify external imported bspline "
-                                                    << getFullName() << ": " << key << ", " << err);
+                                            task.warn("Failed to simplify external imported bspline", ", " + err);
                                     }
                                 }
                                 GeometryFacade::setConstruction(bspline, true);
@@ -8144,7 +8253,7 @@ void SketchObject::rebuildExternalGeometry(bool defining, bool addIntersection)
                             }
                         }
                         else {
-                            FC_ERR("Not supported projected geometry in sketch " << getFullName() << ": " << key);
+                            task.error("Not supported projected geometry in sketch");
                             geos.clear();
                         }
                     }
@@ -8177,15 +8286,19 @@ void SketchObject::rebuildExternalGeometry(bool defining, bool addIntersection)
                 importVertex(refSubShape);
                 break;
             default:
-                FC_ERR("Unknown type of geometry in " << getFullName() << ": " << key);
+                task.error("Unknown type of geometry in");
                 break;
             }
 
             if (intersection && (refSubShape.ShapeType() == TopAbs_EDGE
                                  || refSubShape.ShapeType() == TopAbs_FACE))
             {
-                BRepAlgoAPI_Section maker(refSubShape, sketchPlane);
-                maker.Approximation(Standard_True);
+                // Other projections may run concurrently on shapes sharing
+                // sub-shapes with this one, so the section must not modify
+                // its arguments, e.g. by adding tolerance to their vertices
+                BRepAlgoAPI_Section maker(refSubShape, sketchPlane, Standard_False);
+                maker.SetNonDestructive(Standard_True);
+                maker.Build();
                 if (!maker.IsDone())
                     FC_THROWM(Base::CADKernelError,"Failed to get intersection");
                 Part::TopoShape intersectionShape(maker.Shape());
@@ -8217,22 +8330,50 @@ void SketchObject::rebuildExternalGeometry(bool defining, bool addIntersection)
             }
 
         } catch (Base::Exception &e) {
-            FC_ERR("Failed to project external geometry in "
-                   << getFullName() << ": " << key << std::endl << e.what());
-            continue;
+            task.fail(e.what());
         } catch (Standard_Failure &e) {
-            FC_ERR("Failed to project external geometry in "
-                   << getFullName() << ": " << key << std::endl << e.GetMessageString());
-            continue;
+            task.fail(e.GetMessageString());
         } catch (std::exception &e) {
-            FC_ERR("Failed to project external geometry in "
-                   << getFullName() << ": " << key << std::endl << e.what());
-            continue;
+            task.fail(e.what());
         } catch (...) {
-            FC_ERR("Failed to project external geometry in "
-                   << getFullName() << ": " << key << std::endl << "Unknown exception");
+            task.fail("Unknown exception");
+        }
+    };
+
+    std::vector<ProjectionTask *> pending;
+    for (auto &task : tasks) {
+        if (!task.cached)
+            pending.push_back(&task);
+    }
+    if (pending.size() > 1)
+        QtConcurrent::blockingMap(pending, [&project](ProjectionTask *task) { project(*task); });
+    else if (pending.size() == 1)
+        project(*pending.front());
+
+    std::set<std::string> projectedKeys;
+    for (auto &task : tasks) {
+        const std::string &key = task.key;
+        auto &geos = task.geos;
+
+        for (auto &msg : task.messages) {
+            if (msg.error)
+                FC_ERR(msg.text << " " << getFullName() << ": " << key << msg.detail);
+            else
+                FC_WARN(msg.text << " " << getFullName() << ": " << key << msg.detail);
+        }
+        if (task.failed)
             continue;
+
+        projectedKeys.insert(key);
+        if (!task.cached) {
+            ExternalProjection &projection = externalProjections[key];
+            projection.shape = task.shape;
+            projection.intersection = task.intersection;
+            projection.geos.clear();
+            for (auto &geo : geos)
+                projection.geos.emplace_back(geo->clone());
         }
+
         if(geos.empty())
             continue;
 
@@ -8240,13 +8381,13 @@ void SketchObject::rebuildExternalGeometry(bool defining, bool addIntersection)
             FC_WARN("Duplicated external reference in " << getFullName() << ": " << key);
             continue;
         }
-        if (intersection) {
+        if (task.intersection) {
             for(auto &geo : geos) {
                 auto egf = ExternalGeometryFacade::getFacade(geo.get());
                 egf->setFlag(ExternalGeometryExtension::Intersection);
                 egf->setFlag(ExternalGeometryExtension::Defining, defining);
             }
-        } else if (defining && i+1==(int)Objects.size()) {
+        } else if (defining && task.index+1==(int)Objects.size()) {
             for(auto &geo : geos)
                 ExternalGeometryFacade::getFacade(geo.get())->setFlag(
                         ExternalGeometryExtension::Defining);
@@ -8256,6 +8397,14 @@ void SketchObject::rebuildExternalGeometry(bool defining, bool addIntersection)
         newGeos.push_back(std::move(geos));
     }
 
+    // forget the projections of removed references
+    for (auto it = externalProjections.begin(); it != externalProjections.end();) {
+        if (projectedKeys.count(it->first))
+            ++it;
+        else
+            it = externalProjections.erase(it);
+    }
+
     // allocate unique geometry id
     for(auto &geos : newGeos) {
         auto egf = ExternalGeometryFacade::getFacade(geos.front().get());
@@ -779,6 +779,18 @@ private:
     // mapping from ExternalGeo[*].Id to index of ExternalGeo
     std::map<long,int> externalGeoMap;
 
+    // Projections of the external references made by rebuildExternalGeometry(),
+    // keyed like externalGeoRefMap. A reference is only projected again if its
+    // shape or the sketch placement or projection settings changed.
+    struct ExternalProjection {
+        TopoDS_Shape shape;
+        bool intersection;
+        std::vector<std::unique_ptr<Part::Geometry> > geos;
+    };
+    std::map<std::string, ExternalProjection> externalProjections;
+    Base::Placement externalProjectionPlacement;
+    std::vector<double> externalProjectionSettings;
+
     // mapping from Geometry[*].Id to index of Geometry
     std::map<long,int> geoMap;
 
@@ -203,6 +203,16 @@ Py::Object SketchPy::getShape(void) const
     return Py::asObject(new TopoShapePy(new TopoShape(getSketchPtr()->toShape())));
 }
 
+Py::Boolean SketchPy::getSparseJacobian(void) const
+{
+    return Py::Boolean(getSketchPtr()->getJacobianType() == GCS::SparseJacobian);
+}
+
+void SketchPy::setSparseJacobian(Py::Boolean arg)
+{
+    getSketchPtr()->setJacobianType(arg ? GCS::SparseJacobian : GCS::DenseJacobian);
+}
+
 
 // +++ custom attributes implementer ++++++++++++++++++++++++++++++++++++++++
 
@@ -459,6 +459,7 @@ System::System()
   , convergenceRedundant(1e-10)
   , qrAlgorithm(EigenSparseQR)
   , dogLegGaussStep(FullPivLU)
+  , jacobianType(DenseJacobian)
   , qrpivotThreshold(1E-13)
   , debugMode(Minimal)
   , LM_eps(1E-10)
@@ -1595,6 +1596,58 @@ int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
     return res;
 }
 
+int System::solveAffected(const SET_pD &params, bool isFine, Algorithm alg, bool isRedundantsolving)
+{
+    // the partitioning is lost when temporary constraints are removed after dragging
+    if (!isInit) {
+        initSolution(alg);
+        if (!isInit)
+            return Failed;
+    }
+
+    // the current configuration becomes the reference, so that undoSolution()
+    // and any subsequent full solve start from it
+    setReference();
+
+    int res = Success;
+    for (int cid=0; cid < int(subSystems.size()); cid++) {
+        bool affected = false;
+        for (std::vector<Constraint *>::const_iterator constr=clists[cid].begin();
+             constr != clists[cid].end() && !affected; ++constr) {
+            VEC_pD &cparams = c2p[*constr];
+            for (VEC_pD::const_iterator param=cparams.begin(); param != cparams.end(); ++param) {
+                if (params.count(*param)) {
+                    affected = true;
+                    break;
+                }
+            }
+        }
+        if (!affected) {
+            // keep applySolution() from writing back values of an older solution
+            if (subSystems[cid])
+                subSystems[cid]->fetchParams();
+            if (subSystemsAux[cid])
+                subSystemsAux[cid]->fetchParams();
+            continue;
+        }
+        if (subSystems[cid] && subSystemsAux[cid])
+            res = std::max(res, solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving));
+        else if (subSystems[cid])
+            res = std::max(res, solve(subSystems[cid], isFine, alg, isRedundantsolving));
+        else if (subSystemsAux[cid])
+            res = std::max(res, solve(subSystemsAux[cid], isFine, alg, isRedundantsolving));
+    }
+    if (res == Success) {
+        for (std::set<Constraint *>::const_iterator constr=redundant.begin();
+             constr != redundant.end(); ++constr){
+            double err = (*constr)->error();
+            if (err*err > (isRedundantsolving?convergenceRedundant:convergence))
+                return Converged;
+        }
+    }
+    return res;
+}
+
 int System::solve(SubSystem *subsys, bool isFine, Algorithm alg, bool isRedundantsolving)
 {
     if (alg == BFGS)
@@ -1730,8 +1783,112 @@ int System::solve_BFGS(SubSystem *subsys, bool /*isFine*/, bool isRedundantsolvi
     return Failed;
 }
 
+namespace {
+
+// Helpers for the solvers to work on dense and sparse matrices alike
+
+void getDiagonal(const Eigen::MatrixXd &A, Eigen::VectorXd &diag)
+{
+    diag = A.diagonal();
+}
+
+void setDiagonal(Eigen::MatrixXd &A, const Eigen::VectorXd &diag)
+{
+    A.diagonal() = diag;
+}
+
+void solveLinear(const Eigen::MatrixXd &A, const Eigen::VectorXd &b, Eigen::VectorXd &x)
+{
+    x = A.fullPivLu().solve(b);
+}
+
+// Gauss-Newton step of the DogLeg solver, solves J*h = -fx
+void gaussNewtonStep(const Eigen::MatrixXd &J, const Eigen::VectorXd &fx,
+                     DogLegGaussStep mode, Eigen::VectorXd &h)
+{
+    // http://forum.freecadweb.org/viewtopic.php?f=10&t=12769&start=50#p106220
+    // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
+    switch (mode){
+        case FullPivLU:
+            h = J.fullPivLu().solve(-fx);
+            break;
+        case LeastNormFullPivLU:
+            h = J.adjoint()*(J*J.adjoint()).fullPivLu().solve(-fx);
+            break;
+        case LeastNormLdlt:
+            h = J.adjoint()*(J*J.adjoint()).ldlt().solve(-fx);
+            break;
+    }
+}
+
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+typedef Eigen::SparseMatrix<double> SparseMatrix;
+
+void getDiagonal(const SparseMatrix &A, Eigen::VectorXd &diag)
+{
+    diag.resize(A.rows());
+    for (int i=0; i < A.rows(); ++i)
+        diag(i) = A.coeff(i,i);
+}
+
+void setDiagonal(SparseMatrix &A, const Eigen::VectorXd &diag)
+{
+    for (int i=0; i < A.rows(); ++i)
+        A.coeffRef(i,i) = diag(i);
+}
+
+// A is symmetric positive definite, as it is used for the damped normal equations only
+void solveLinear(const SparseMatrix &A, const Eigen::VectorXd &b, Eigen::VectorXd &x)
+{
+    Eigen::SimplicialLDLT<SparseMatrix> ldlt(A);
+    x = ldlt.solve(b);
+}
+
+// The least norm solution h = J^T*(J*J^T)^-1*(-fx) is used regardless of the mode. J*J^T is
+// positive definite as long as J has full row rank, which is given for a system without
+// redundant constraints away from singular configurations. Otherwise the product is
+// slightly regularized.
+void gaussNewtonStep(const SparseMatrix &J, const Eigen::VectorXd &fx,
+                     DogLegGaussStep /*mode*/, Eigen::VectorXd &h)
+{
+    SparseMatrix JJt = J*J.transpose();
+    Eigen::SimplicialLDLT<SparseMatrix> ldlt(JJt);
+    if (ldlt.info() == Eigen::Success) {
+        h = J.transpose()*ldlt.solve(-fx);
+        if (ldlt.info() == Eigen::Success && h.allFinite())
+            return;
+    }
+    Eigen::VectorXd diag;
+    getDiagonal(JJt, diag);
+    setDiagonal(JJt, (diag.array() + 1e-10*(1. + diag.lpNorm<Eigen::Infinity>())).matrix());
+    ldlt.compute(JJt);
+    h = J.transpose()*ldlt.solve(-fx);
+}
+#endif
+
+} // anonymous namespace
+
 int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 {
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (jacobianType == SparseJacobian)
+        return solve_LM_impl<SparseMatrix>(subsys, isRedundantsolving);
+#endif
+    return solve_LM_impl<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
+{
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (jacobianType == SparseJacobian)
+        return solve_DL_impl<SparseMatrix>(subsys, isRedundantsolving);
+#endif
+    return solve_DL_impl<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template <typename MatrixType>
+int System::solve_LM_impl(SubSystem* subsys, bool isRedundantsolving)
+{
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
 #endif
@@ -1743,8 +1900,8 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         return Success;
 
     Eigen::VectorXd e(csize), e_new(csize); // vector of all function errors (every constraint is one function)
-    Eigen::MatrixXd J(csize, xsize);        // Jacobi of the subsystem
-    Eigen::MatrixXd A(xsize, xsize);
+    MatrixType J(csize, xsize);             // Jacobi of the subsystem
+    MatrixType A(xsize, xsize);
     Eigen::VectorXd x(xsize), h(xsize), x_new(xsize), g(xsize), diag_A(xsize);
 
     subsys->redirectParams();
@@ -1799,7 +1956,7 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
         // Compute ||J^T e||_inf
         double g_inf = g.lpNorm<Eigen::Infinity>();
-        diag_A = A.diagonal(); // save diagonal entries so that augmentation can be later canceled
+        getDiagonal(A, diag_A); // save diagonal entries so that augmentation can be later canceled
 
         // check for convergence
         if (g_inf <= eps1) {
@@ -1816,11 +1973,10 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         int k=0;
         while (k < 50) {
             // augment normal equations A = A+uI
-            for (int i=0; i < xsize; ++i)
-                A(i,i) += mu;
+            setDiagonal(A, (diag_A.array() + mu).matrix());
 
             //solve augmented functions A*h=-g
-            h = A.fullPivLu().solve(g);
+            solveLinear(A, g, h);
             double rel_error = (A*h - g).norm() / g.norm();
 
             // check if solving works
@@ -1868,8 +2024,7 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
             mu*=nu;
             nu*=2.0;
-            for (int i=0; i < xsize; ++i) // restore diagonal J^T J entries
-                A(i,i) = diag_A(i);
+            setDiagonal(A, diag_A); // restore diagonal J^T J entries
 
             k++;
         }
@@ -1900,7 +2055,8 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 }
 
 
-int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
+template <typename MatrixType>
+int System::solve_DL_impl(SubSystem* subsys, bool isRedundantsolving)
 {
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
@@ -1937,7 +2093,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd x(xsize), x_new(xsize);
     Eigen::VectorXd fx(csize), fx_new(csize);
-    Eigen::MatrixXd Jx(csize, xsize), Jx_new(csize, xsize);
+    MatrixType Jx(csize, xsize), Jx_new(csize, xsize);
     Eigen::VectorXd g(xsize), h_sd(xsize), h_gn(xsize), h_dl(xsize);
 
     subsys->redirectParams();
@@ -1979,19 +2135,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
             h_sd  = alpha*g;
 
             // get the gauss-newton step
-            // http://forum.freecadweb.org/viewtopic.php?f=10&t=12769&start=50#p106220
-            // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
-            switch (dogLegGaussStep){
-                case FullPivLU:
-                    h_gn = Jx.fullPivLu().solve(-fx);
-                    break;
-                case LeastNormFullPivLU:
-                    h_gn = Jx.adjoint()*(Jx*Jx.adjoint()).fullPivLu().solve(-fx);
-                    break;
-                case LeastNormLdlt:
-                    h_gn = Jx.adjoint()*(Jx*Jx.adjoint()).ldlt().solve(-fx);
-                    break;
-            }
+            gaussNewtonStep(Jx, fx, dogLegGaussStep, h_gn);
 
             double rel_error = (Jx*h_gn + fx).norm() / fx.norm();
             if (rel_error > 1e15)
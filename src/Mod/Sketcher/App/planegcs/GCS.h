@@ -74,6 +74,11 @@ namespace GCS
         EigenSparseQR = 1
     };
 
+    enum JacobianType {
+        DenseJacobian = 0,
+        SparseJacobian = 1
+    };
+
     enum DebugMode {
         NoDebug = 0,
         Minimal = 1,
@@ -137,6 +142,12 @@ namespace GCS
         int solve_LM(SubSystem *subsys, bool isRedundantsolving=false);
         int solve_DL(SubSystem *subsys, bool isRedundantsolving=false);
 
+        // MatrixType is the type of the Jacobian, Eigen::MatrixXd or Eigen::SparseMatrix<double>
+        template <typename MatrixType>
+        int solve_LM_impl(SubSystem *subsys, bool isRedundantsolving);
+        template <typename MatrixType>
+        int solve_DL_impl(SubSystem *subsys, bool isRedundantsolving);
+
         void makeReducedJacobian(Eigen::MatrixXd &J, std::map<int,int> &jacobianconstraintmap, GCS::VEC_pD &pdiagnoselist, std::map< int , int> &tagmultiplicity);
 
         void makeDenseQRDecomposition(  const Eigen::MatrixXd &J,
@@ -203,6 +214,7 @@ namespace GCS
         double convergenceRedundant;
         QRAlgorithm qrAlgorithm;
         DogLegGaussStep dogLegGaussStep;
+        JacobianType jacobianType; // of the LevenbergMarquardt and DogLeg solvers
         double qrpivotThreshold;
         DebugMode debugMode;
         double LM_eps;
@@ -346,6 +358,10 @@ namespace GCS
         int solve(VEC_pD &params, bool isFine=true, Algorithm alg=DogLeg, bool isRedundantsolving=false);
         int solve(SubSystem *subsys, bool isFine=true, Algorithm alg=DogLeg, bool isRedundantsolving=false);
         int solve(SubSystem *subsysA, SubSystem *subsysB, bool isFine=true, bool isRedundantsolving=false);
+        // Solves only the decoupled components with constraints depending on any of the
+        // given parameters, starting from the current parameter values. The other
+        // components are left as they are.
+        int solveAffected(const SET_pD &params, bool isFine=true, Algorithm alg=DogLeg, bool isRedundantsolving=false);
 
         void applySolution();
         void undoSolution();
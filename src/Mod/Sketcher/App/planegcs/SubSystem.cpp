@@ -131,9 +131,7 @@ void SubSystem::initialize(VEC_pD &params, MAP_pD_pD &reductionmap)
 void SubSystem::redirectParams()
 {
     // copying values to pvals
-    for (MAP_pD_pD::const_iterator p=pmap.begin();
-         p != pmap.end(); ++p)
-        *(p->second) = *(p->first);
+    fetchParams();
 
     // redirect constraints to point to pvals
     for (std::vector<Constraint *>::iterator constr=clist.begin();
@@ -150,6 +148,13 @@ void SubSystem::revertParams()
         (*constr)->revertParams();
 }
 
+void SubSystem::fetchParams()
+{
+    for (MAP_pD_pD::const_iterator p=pmap.begin();
+         p != pmap.end(); ++p)
+        *(p->second) = *(p->first);
+}
+
 void SubSystem::getParamMap(MAP_pD_pD &pmapOut)
 {
     pmapOut = pmap;
@@ -275,6 +280,21 @@ void SubSystem::calcJacobi(Eigen::MatrixXd &jacobi)
     calcJacobi(plist, jacobi);
 }
 
+void SubSystem::calcJacobi(Eigen::SparseMatrix<double> &jacobi)
+{
+    // Only the parameters of a constraint are visited. Zero derivatives are
+    // stored nevertheless, so that the structure of the normal equations does
+    // not change between iterations and their diagonal is always present.
+    std::vector<Eigen::Triplet<double> > entries;
+    for (int i=0; i < csize; i++) {
+        const VEC_pD &cparams = c2p[clist[i]];
+        for (VEC_pD::const_iterator p=cparams.begin(); p != cparams.end(); ++p)
+            entries.emplace_back(i, int(*p - &pvals[0]), clist[i]->grad(*p));
+    }
+    jacobi.resize(csize, psize);
+    jacobi.setFromTriplets(entries.begin(), entries.end());
+}
+
 void SubSystem::calcGrad(VEC_pD &params, Eigen::VectorXd &grad)
 {
     assert(grad.size() == int(params.size()));
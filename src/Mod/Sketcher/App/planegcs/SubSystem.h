@@ -27,6 +27,7 @@
 #undef max
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 #include "Constraints.h"
 
 namespace GCS
@@ -55,6 +56,7 @@ namespace GCS
 
         void redirectParams();
         void revertParams();
+        void fetchParams(); // copies the values of the original parameters to pvals
 
         void getParamMap(MAP_pD_pD &pmapOut);
         void getParamList(VEC_pD &plistOut);
@@ -71,6 +73,7 @@ namespace GCS
         void calcResidual(Eigen::VectorXd &r, double &err);
         void calcJacobi(VEC_pD &params, Eigen::MatrixXd &jacobi);
         void calcJacobi(Eigen::MatrixXd &jacobi);
+        void calcJacobi(Eigen::SparseMatrix<double> &jacobi);
         void calcGrad(VEC_pD &params, Eigen::VectorXd &grad);
         void calcGrad(Eigen::VectorXd &grad);
 
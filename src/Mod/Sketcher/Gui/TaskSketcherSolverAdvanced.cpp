@@ -56,6 +56,7 @@
 #define DEFAULT_SOLVER_DEBUG 1      // None=0, Minimal=1, IterationLevel=2
 #define MAX_ITER_MULTIPLIER false
 #define DEFAULT_DOGLEG_GAUSS_STEP 0   // FullPivLU = 0, LeastNormFullPivLU = 1, LeastNormLdlt = 2
+#define DEFAULT_JACOBIAN_TYPE 0       // DenseJacobian = 0, SparseJacobian = 1
 
 using namespace SketcherGui;
 using namespace Gui::TaskView;
@@ -74,6 +75,7 @@ TaskSketcherSolverAdvanced::TaskSketcherSolverAdvanced(ViewProviderSketch *sketc
 
     ui->comboBoxDefaultSolver->onRestore();
     ui->comboBoxDogLegGaussStep->onRestore();
+    ui->comboBoxJacobianType->onRestore();
     ui->spinBoxMaxIter->onRestore();
     ui->checkBoxSketchSizeMultiplier->onRestore();
     ui->lineEditConvergence->onRestore();
@@ -104,6 +106,9 @@ void TaskSketcherSolverAdvanced::updateDefaultMethodParameters(void)
     else
         ui->comboBoxDogLegGaussStep->setEnabled(false);
 
+    // BFGS always uses a dense matrix
+    ui->comboBoxJacobianType->setEnabled(redundantcurrentindex != 0 || currentindex != 0);
+
     switch(currentindex)
     {
         case 0: // BFGS
@@ -173,6 +178,9 @@ void TaskSketcherSolverAdvanced::updateRedundantMethodParameters(void)
     else
         ui->comboBoxDogLegGaussStep->setEnabled(false);
 
+    // BFGS always uses a dense matrix
+    ui->comboBoxJacobianType->setEnabled(redundantcurrentindex != 0 || currentindex != 0);
+
     switch(redundantcurrentindex)
     {
         case 0: // BFGS
@@ -409,6 +417,12 @@ void TaskSketcherSolverAdvanced::on_comboBoxDogLegGaussStep_currentIndexChanged(
     updateDefaultMethodParameters();
 }
 
+void TaskSketcherSolverAdvanced::on_comboBoxJacobianType_currentIndexChanged(int index)
+{
+    ui->comboBoxJacobianType->onSave();
+    const_cast<Sketcher::Sketch &>(sketchView->getSketchObject()->getSolvedSketch()).setJacobianType((GCS::JacobianType) index);
+}
+
 void TaskSketcherSolverAdvanced::on_spinBoxMaxIter_valueChanged(int i)
 {
     ui->spinBoxMaxIter->onSave();
@@ -532,6 +546,7 @@ void TaskSketcherSolverAdvanced::on_pushButtonDefaults_clicked(bool checked/* =
     // Set other settings
     hGrp->SetInt("DefaultSolver",DEFAULT_SOLVER);
     hGrp->SetInt("DogLegGaussStep",DEFAULT_DOGLEG_GAUSS_STEP);
+    hGrp->SetInt("JacobianType",DEFAULT_JACOBIAN_TYPE);
 
     hGrp->SetInt("RedundantDefaultSolver",DEFAULT_RSOLVER);
     hGrp->SetInt("MaxIter",MAX_ITER);
@@ -546,6 +561,7 @@ void TaskSketcherSolverAdvanced::on_pushButtonDefaults_clicked(bool checked/* =
 
     ui->comboBoxDefaultSolver->onRestore();
     ui->comboBoxDogLegGaussStep->onRestore();
+    ui->comboBoxJacobianType->onRestore();
     ui->spinBoxMaxIter->onRestore();
     ui->checkBoxSketchSizeMultiplier->onRestore();
     ui->lineEditConvergence->onRestore();
@@ -574,6 +590,7 @@ void TaskSketcherSolverAdvanced::updateSketchObject(void)
     const_cast<Sketcher::Sketch &>(sketchView->getSketchObject()->getSolvedSketch()).setMaxIter(ui->spinBoxMaxIter->value());
     const_cast<Sketcher::Sketch &>(sketchView->getSketchObject()->getSolvedSketch()).defaultSolver=(GCS::Algorithm) ui->comboBoxDefaultSolver->currentIndex();
     const_cast<Sketcher::Sketch &>(sketchView->getSketchObject()->getSolvedSketch()).setDogLegGaussStep((GCS::DogLegGaussStep) ui->comboBoxDogLegGaussStep->currentIndex());
+    const_cast<Sketcher::Sketch &>(sketchView->getSketchObject()->getSolvedSketch()).setJacobianType((GCS::JacobianType) ui->comboBoxJacobianType->currentIndex());
 
     updateDefaultMethodParameters();
     updateRedundantMethodParameters();
@@ -349,6 +349,32 @@ struct EditData {
     std::map<QString, ViewProviderSketch::ConstrIconBBVec> combinedConstrBoxes;
     std::map<int, int> combinedConstrMap;
 
+    // Rendered constraint icons keyed by type, size, rotation, labels and
+    // colors, as drawing the same icons again on every redraw is costly
+    struct ConstrIconCacheItem {
+        QImage image;
+        std::vector<QRect> boundingBoxes;
+        int vPad;
+    };
+    std::map<QString, ConstrIconCacheItem> constrIconCache;
+    // the icon last sent to each SoImage, to skip sending it again
+    std::map<SoImage *, QImage> coinIcons;
+
+    // Tessellation of the curves in the last draw(), indexed like the complete
+    // geometry. Only curves that changed since are tessellated again.
+    struct CurveCacheItem {
+        std::unique_ptr<Part::Geometry> geo;
+        std::vector<Base::Vector3d> coords;
+        std::vector<unsigned int> index;
+    };
+    std::vector<CurveCacheItem> curveCache;
+    std::vector<double> curveCacheSettings;
+
+    // buffers of draw(), kept to avoid reallocating them on every redraw while dragging
+    std::vector<Base::Vector3d> Coords;
+    std::vector<Base::Vector3d> Points;
+    std::vector<unsigned int> Index;
+
     // nodes for the visuals
     SoSeparator   *EditRoot;
     SoSwitch      *PointSwitch;
@@ -3786,6 +3812,14 @@ QString ViewProviderSketch::iconTypeFromConstraint(Constraint *constraint)
 
 void ViewProviderSketch::sendConstraintIconToCoin(const QImage &icon, SoImage *soImagePtr)
 {
+    // Converting the icon and sending it to the graphics card is costly, so skip it
+    // if the node already shows the same icon. The check is cheap for icons coming
+    // from the icon cache, as they share their data.
+    QImage &shownIcon = edit->coinIcons[soImagePtr];
+    if (!shownIcon.isNull() && shownIcon == icon)
+        return;
+    shownIcon = icon;
+
     SoSFImage icondata = SoSFImage();
 
     Gui::BitmapFactory().convert(icon, icondata);
@@ -3802,7 +3836,11 @@ void ViewProviderSketch::sendConstraintIconToCoin(const QImage &icon, SoImage *s
 
 void ViewProviderSketch::clearCoinImage(SoImage *soImagePtr)
 {
+    auto it = edit->coinIcons.find(soImagePtr);
+    if (it != edit->coinIcons.end() && it->second.isNull())
+        return; // already cleared
     soImagePtr->setToDefaults();
+    edit->coinIcons[soImagePtr] = QImage();
 }
 
 QColor ViewProviderSketch::constrColor(int constraintId)
@@ -4071,7 +4109,8 @@ void ViewProviderSketch::combineConstraintIcons(IconQueue &&iconQueue)
 
 void ViewProviderSketch::drawMergedConstraintIcons(IconQueue &&iconQueue)
 {
-    for(IconQueue::iterator i = iconQueue.begin(); i != iconQueue.end(); ++i) {
+    // the first destination receives the merged icon below
+    for(IconQueue::iterator i = iconQueue.begin() + 1; i != iconQueue.end(); ++i) {
         clearCoinImage(i->destination);
     }
 
@@ -4220,6 +4259,39 @@ QImage ViewProviderSketch::renderConstrIcon(const QString &type,
                                             std::vector<QRect> *boundingBoxes,
                                             int *vPad)
 {
+    QFont font = QApplication::font();
+    font.setPixelSize(static_cast<int>(1.0 * edit->constraintIconSize));
+    font.setBold(true);
+
+    QStringList keyParts;
+    keyParts << type
+             << QString::number(edit->constraintIconSize)
+             << QString::number(iconColor.rgba())
+             << QString::number(iconRotation)
+             << font.key();
+    for (int i=0; i<labels.size(); ++i) {
+        keyParts << labels[i];
+        if (i < labelColors.size())
+            keyParts << QString::number(labelColors[i].rgba());
+    }
+    QString key = keyParts.join(QLatin1Char('\n'));
+
+    auto cached = edit->constrIconCache.find(key);
+    if (cached != edit->constrIconCache.end()) {
+        if (boundingBoxes)
+            boundingBoxes->insert(boundingBoxes->end(),
+                                  cached->second.boundingBoxes.begin(),
+                                  cached->second.boundingBoxes.end());
+        if (vPad)
+            *vPad = cached->second.vPad;
+        return cached->second.image;
+    }
+
+    // Icons rotate with the geometry, so keep the cache from growing without bounds while dragging
+    if (edit->constrIconCache.size() > 1000)
+        edit->constrIconCache.clear();
+    EditData::ConstrIconCacheItem &item = edit->constrIconCache[key];
+
     // Constants to help create constraint icons
     QString joinStr = QStringLiteral(", ");
 
@@ -4232,17 +4304,13 @@ QImage ViewProviderSketch::renderConstrIcon(const QString &type,
     }
     QImage icon = pxMap.toImage();
 
-    QFont font = QApplication::font();
-    font.setPixelSize(static_cast<int>(1.0 * edit->constraintIconSize));
-    font.setBold(true);
     QFontMetrics qfm = QFontMetrics(font);
 
     int labelWidth = qfm.boundingRect(labels.join(joinStr)).width();
     // See Qt docs on qRect::bottom() for explanation of the +1
     int pxBelowBase = qfm.boundingRect(labels.join(joinStr)).bottom() + 1;
 
-    if(vPad)
-        *vPad = pxBelowBase;
+    item.vPad = pxBelowBase;
 
     QTransform rotation;
     rotation.rotate(iconRotation);
@@ -4252,8 +4320,7 @@ QImage ViewProviderSketch::renderConstrIcon(const QString &type,
                                                         roticon.height() + pxBelowBase);
 
     // Make a bounding box for the icon
-    if(boundingBoxes)
-        boundingBoxes->push_back(QRect(0, 0, roticon.width(), roticon.height()));
+    item.boundingBoxes.push_back(QRect(0, 0, roticon.width(), roticon.height()));
 
     // Render the Icons
     QPainter qp(&image);
@@ -4289,17 +4356,24 @@ QImage ViewProviderSketch::renderConstrIcon(const QString &type,
             //       icon.width() is ever very small (or removed).
             qp.drawText(icon.width() + cursorOffset, icon.height(), labelStr);
 
-            if(boundingBoxes) {
-                labelBB = qfm.boundingRect(labelStr);
-                labelBB.moveTo(icon.width() + cursorOffset,
-                               icon.height() - qfm.height() + pxBelowBase);
-                boundingBoxes->push_back(labelBB);
-            }
+            labelBB = qfm.boundingRect(labelStr);
+            labelBB.moveTo(icon.width() + cursorOffset,
+                           icon.height() - qfm.height() + pxBelowBase);
+            item.boundingBoxes.push_back(labelBB);
 
             cursorOffset += Gui::QtTools::horizontalAdvance(qfm, labelStr);
         }
     }
 
+    // end the painter before sharing the image with the cache
+    qp.end();
+    item.image = image;
+
+    if (boundingBoxes)
+        boundingBoxes->insert(boundingBoxes->end(), item.boundingBoxes.begin(), item.boundingBoxes.end());
+    if (vPad)
+        *vPad = item.vPad;
+
     return image;
 }
 
@@ -4603,9 +4677,12 @@ void ViewProviderSketch::draw(bool temp /*=false*/, bool rebuildinformationlayer
         return;
 
     // Render Geometry ===================================================
-    std::vector<Base::Vector3d> Coords;
-    std::vector<Base::Vector3d> Points;
-    std::vector<unsigned int> Index;
+    std::vector<Base::Vector3d> &Coords = edit->Coords;
+    std::vector<Base::Vector3d> &Points = edit->Points;
+    std::vector<unsigned int> &Index = edit->Index;
+    Coords.clear();
+    Points.clear();
+    Index.clear();
 
     auto sketch = getSketchObject();
     int intGeoCount = sketch->getHighestCurveIndex() + 1;
@@ -4681,6 +4758,23 @@ void ViewProviderSketch::draw(bool temp /*=false*/, bool rebuildinformationlayer
     if (stdcountsegments < 3)
         stdcountsegments = 3;
 
+    // the cached tessellation of the curves is only valid for the same settings
+    std::vector<double> curveCacheSettings = {
+        double(stdcountsegments),
+        Deviation.getValue(),
+        AngularDeflection.getValue(),
+        PartGui::PartParams::getOverrideTessellation() ? 1.0 : 0.0,
+        PartGui::PartParams::getMeshDeviation(),
+        PartGui::PartParams::getMinimumDeviation(),
+        PartGui::PartParams::getMeshAngularDeflection(),
+        PartGui::PartParams::getMinimumAngularDeflection()
+    };
+    if (curveCacheSettings != edit->curveCacheSettings) {
+        edit->curveCache.clear();
+        edit->curveCacheSettings = std::move(curveCacheSettings);
+    }
+    edit->curveCache.resize(tempGeo.size());
+
     // RootPoint
     Points.emplace_back(0.,0.,0.);
 
@@ -4695,6 +4789,30 @@ void ViewProviderSketch::draw(bool temp /*=false*/, bool rebuildinformationlayer
 
     for (int GeoId : geoIndices) {
         auto it = tempGeo.begin() + GeoId;
+
+        // Lines and points are cheap to draw, and the circles representing B-Spline
+        // weights depend on other geometry, so only the tessellation of the other
+        // curves is reused, if they did not change since the last draw
+        EditData::CurveCacheItem &cacheItem = edit->curveCache[GeoId];
+        Base::Type type = (*it)->getTypeId();
+        bool cacheable = type == Part::GeomEllipse::getClassTypeId()
+                      || type == Part::GeomArcOfCircle::getClassTypeId()
+                      || type == Part::GeomArcOfEllipse::getClassTypeId()
+                      || type == Part::GeomArcOfHyperbola::getClassTypeId()
+                      || type == Part::GeomArcOfParabola::getClassTypeId()
+                      || type == Part::GeomBSplineCurve::getClassTypeId()
+                      || (type == Part::GeomCircle::getClassTypeId()
+                          && !GeometryFacade::isInternalType(*it, InternalType::BSplineControlPoint));
+        bool cached = cacheable && cacheItem.geo
+                   && cacheItem.geo->getTypeId() == type
+                   && cacheItem.geo->isSame(**it, Precision::Confusion(), Precision::Angular());
+        std::size_t coordStart = Coords.size();
+        std::size_t indexStart = Index.size();
+        if (cached) {
+            Coords.insert(Coords.end(), cacheItem.coords.begin(), cacheItem.coords.end());
+            Index.insert(Index.end(), cacheItem.index.begin(), cacheItem.index.end());
+        }
+
         if (GeoId >= intGeoCount)
             GeoId -= intGeoCount + extGeoCount;
         if ((*it)->getTypeId() == Part::GeomPoint::getClassTypeId()) { // add a point
@@ -4816,7 +4934,7 @@ void ViewProviderSketch::draw(bool temp /*=false*/, bool rebuildinformationlayer
                     }
                 }
             }
-            else {
+            else if (!cached) {
 
                 double segment = (2 * M_PI) / countSegments;
 
@@ -4829,7 +4947,8 @@ void ViewProviderSketch::draw(bool temp /*=false*/, bool rebuildinformationlayer
                 Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
             }
 
-            Index.push_back(countSegments+1);
+            if (!cached)
+                Index.push_back(countSegments+1);
             edit->CurvIdToGeoId.push_back(GeoId);
             Points.push_back(center);
             setPointId(GeoId, PointPos::mid);
@@ -4840,16 +4959,18 @@ void ViewProviderSketch::draw(bool temp /*=false*/, bool rebuildinformationlayer
 
             int countSegments = stdcountsegments;
             Base::Vector3d center = ellipse->getCenter();
-            double segment = (2 * M_PI) / countSegments;
-            for (int i=0; i < countSegments; i++) {
-                gp_Pnt pnt = curve->Value(i*segment);
-                Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
-            }
+            if (!cached) {
+                double segment = (2 * M_PI) / countSegments;
+                for (int i=0; i < countSegments; i++) {
+                    gp_Pnt pnt = curve->Value(i*segment);
+                    Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+                }
 
-            gp_Pnt pnt = curve->Value(0);
-            Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+                gp_Pnt pnt = curve->Value(0);
+                Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
 
-            Index.push_back(countSegments+1);
+                Index.push_back(countSegments+1);
+            }
             edit->CurvIdToGeoId.push_back(GeoId);
             Points.push_back(center);
             setPointId(GeoId, PointPos::mid);
@@ -4875,17 +4996,19 @@ void ViewProviderSketch::draw(bool temp /*=false*/, bool rebuildinformationlayer
             Base::Vector3d start  = arc->getStartPoint(/*emulateCCW=*/true);
             Base::Vector3d end    = arc->getEndPoint(/*emulateCCW=*/true);
 
-            for (int i=0; i < countSegments; i++) {
-                gp_Pnt pnt = curve->Value(startangle);
-                Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
-                startangle += segment;
-            }
+            if (!cached) {
+                for (int i=0; i < countSegments; i++) {
+                    gp_Pnt pnt = curve->Value(startangle);
+                    Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+                    startangle += segment;
+                }
 
-            // end point
-            gp_Pnt pnt = curve->Value(endangle);
-            Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+                // end point
+                gp_Pnt pnt = curve->Value(endangle);
+                Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
 
-            Index.push_back(countSegments+1);
+                Index.push_back(countSegments+1);
+            }
             edit->CurvIdToGeoId.push_back(GeoId);
             Points.push_back(start);
             Points.push_back(end);
@@ -4911,17 +5034,19 @@ void ViewProviderSketch::draw(bool temp /*=false*/, bool rebuildinformationlayer
             Base::Vector3d start  = arc->getStartPoint(/*emulateCCW=*/true);
             Base::Vector3d end    = arc->getEndPoint(/*emulateCCW=*/true);
 
-            for (int i=0; i < countSegments; i++) {
-                gp_Pnt pnt = curve->Value(startangle);
-                Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
-                startangle += segment;
-            }
+            if (!cached) {
+                for (int i=0; i < countSegments; i++) {
+                    gp_Pnt pnt = curve->Value(startangle);
+                    Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+                    startangle += segment;
+                }
 
-            // end point
-            gp_Pnt pnt = curve->Value(endangle);
-            Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+                // end point
+                gp_Pnt pnt = curve->Value(endangle);
+                Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
 
-            Index.push_back(countSegments+1);
+                Index.push_back(countSegments+1);
+            }
             edit->CurvIdToGeoId.push_back(GeoId);
             Points.push_back(start);
             Points.push_back(end);
@@ -4947,17 +5072,19 @@ void ViewProviderSketch::draw(bool temp /*=false*/, bool rebuildinformationlayer
             Base::Vector3d start  = aoh->getStartPoint();
             Base::Vector3d end    = aoh->getEndPoint();
 
-            for (int i=0; i < countSegments; i++) {
-                gp_Pnt pnt = curve->Value(startangle);
-                Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
-                startangle += segment;
-            }
+            if (!cached) {
+                for (int i=0; i < countSegments; i++) {
+                    gp_Pnt pnt = curve->Value(startangle);
+                    Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+                    startangle += segment;
+                }
 
-            // end point
-            gp_Pnt pnt = curve->Value(endangle);
-            Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+                // end point
+                gp_Pnt pnt = curve->Value(endangle);
+                Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
 
-            Index.push_back(countSegments+1);
+                Index.push_back(countSegments+1);
+            }
             edit->CurvIdToGeoId.push_back(GeoId);
             Points.push_back(start);
             Points.push_back(end);
@@ -4983,17 +5110,19 @@ void ViewProviderSketch::draw(bool temp /*=false*/, bool rebuildinformationlayer
             Base::Vector3d start  = aop->getStartPoint();
             Base::Vector3d end    = aop->getEndPoint();
 
-            for (int i=0; i < countSegments; i++) {
-                gp_Pnt pnt = curve->Value(startangle);
-                Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
-                startangle += segment;
-            }
+            if (!cached) {
+                for (int i=0; i < countSegments; i++) {
+                    gp_Pnt pnt = curve->Value(startangle);
+                    Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+                    startangle += segment;
+                }
 
-            // end point
-            gp_Pnt pnt = curve->Value(endangle);
-            Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+                // end point
+                gp_Pnt pnt = curve->Value(endangle);
+                Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
 
-            Index.push_back(countSegments+1);
+                Index.push_back(countSegments+1);
+            }
             edit->CurvIdToGeoId.push_back(GeoId);
             Points.push_back(start);
             Points.push_back(end);
@@ -5010,60 +5139,62 @@ void ViewProviderSketch::draw(bool temp /*=false*/, bool rebuildinformationlayer
             Base::Vector3d startp  = spline->getStartPoint();
             Base::Vector3d endp    = spline->getEndPoint();
 
-            // Because BSpline can be arbitrary complex in curvature, using a
-            // constant segment limit won't give satisfying result in many
-            // cases. We opt to use the same way PartGui::ViewProviderPartExt
-            // to discretize the edge.
-            auto edge = Part::TopoShape(spline->toShape());
-            auto bound = edge.getBoundBox();
-            double deflection = std::max(Precision::Confusion(),
-                (bound.LengthX()+bound.LengthY()+bound.LengthZ())/300.0 *
-                    std::max(PartGui::PartParams::getOverrideTessellation() ? 
-                                PartGui::PartParams::getMeshDeviation() : Deviation.getValue(),
-                        PartGui::PartParams::getMinimumDeviation()));
-
-            double angDeflectionRads = std::max(Precision::Angular(),
-                    std::max((PartGui::PartParams::getOverrideTessellation() ?
-                                PartGui::PartParams::getMeshAngularDeflection() : AngularDeflection.getValue()),
-                      PartGui::PartParams::getMinimumAngularDeflection()) / 180.0 * M_PI);
-            edge.meshShape(deflection, angDeflectionRads);
-            TopLoc_Location aLoc;
-            Handle(Poly_Polygon3D) aPoly = BRep_Tool::Polygon3D(TopoDS::Edge(edge.getShape()), aLoc);
-            if (!aPoly.IsNull()) {
-                gp_Trsf trsf;
-                if (!aLoc.IsIdentity())
-                    trsf = aLoc.Transformation();
-                const TColgp_Array1OfPnt& aNodes = aPoly->Nodes();
-                int nbNodesInEdge = aPoly->NbNodes();
-                gp_Pnt pnt;
-                for (Standard_Integer j=1;j <= nbNodesInEdge;j++) {
-                    pnt = aNodes(j);
+            if (!cached) {
+                // Because BSpline can be arbitrary complex in curvature, using a
+                // constant segment limit won't give satisfying result in many
+                // cases. We opt to use the same way PartGui::ViewProviderPartExt
+                // to discretize the edge.
+                auto edge = Part::TopoShape(spline->toShape());
+                auto bound = edge.getBoundBox();
+                double deflection = std::max(Precision::Confusion(),
+                    (bound.LengthX()+bound.LengthY()+bound.LengthZ())/300.0 *
+                        std::max(PartGui::PartParams::getOverrideTessellation() ? 
+                                    PartGui::PartParams::getMeshDeviation() : Deviation.getValue(),
+                            PartGui::PartParams::getMinimumDeviation()));
+
+                double angDeflectionRads = std::max(Precision::Angular(),
+                        std::max((PartGui::PartParams::getOverrideTessellation() ?
+                                    PartGui::PartParams::getMeshAngularDeflection() : AngularDeflection.getValue()),
+                          PartGui::PartParams::getMinimumAngularDeflection()) / 180.0 * M_PI);
+                edge.meshShape(deflection, angDeflectionRads);
+                TopLoc_Location aLoc;
+                Handle(Poly_Polygon3D) aPoly = BRep_Tool::Polygon3D(TopoDS::Edge(edge.getShape()), aLoc);
+                if (!aPoly.IsNull()) {
+                    gp_Trsf trsf;
                     if (!aLoc.IsIdentity())
-                        pnt.Transform(trsf);
-                    Coords.emplace_back((float)(pnt.X()),(float)(pnt.Y()),(float)(pnt.Z()));
-                }
-                Index.push_back(nbNodesInEdge);
-
-            } else {
-                double first = curve->FirstParameter();
-                double last = curve->LastParameter();
-                if (first > last) // if arc is reversed
-                    std::swap(first, last);
+                        trsf = aLoc.Transformation();
+                    const TColgp_Array1OfPnt& aNodes = aPoly->Nodes();
+                    int nbNodesInEdge = aPoly->NbNodes();
+                    gp_Pnt pnt;
+                    for (Standard_Integer j=1;j <= nbNodesInEdge;j++) {
+                        pnt = aNodes(j);
+                        if (!aLoc.IsIdentity())
+                            pnt.Transform(trsf);
+                        Coords.emplace_back((float)(pnt.X()),(float)(pnt.Y()),(float)(pnt.Z()));
+                    }
+                    Index.push_back(nbNodesInEdge);
 
-                double range = last-first;
-                int countSegments = stdcountsegments;
-                double segment = range / countSegments;
+                } else {
+                    double first = curve->FirstParameter();
+                    double last = curve->LastParameter();
+                    if (first > last) // if arc is reversed
+                        std::swap(first, last);
+
+                    double range = last-first;
+                    int countSegments = stdcountsegments;
+                    double segment = range / countSegments;
+
+                    for (int i=0; i < countSegments; i++) {
+                        gp_Pnt pnt = curve->Value(first);
+                        Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+                        first += segment;
+                    }
 
-                for (int i=0; i < countSegments; i++) {
-                    gp_Pnt pnt = curve->Value(first);
-                    Coords.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
-                    first += segment;
+                    // end point
+                    gp_Pnt end = curve->Value(last);
+                    Coords.emplace_back(end.X(), end.Y(), end.Z());
+                    Index.push_back(countSegments+1);
                 }
-
-                // end point
-                gp_Pnt end = curve->Value(last);
-                Coords.emplace_back(end.X(), end.Y(), end.Z());
-                Index.push_back(countSegments+1);
             }
 
             edit->CurvIdToGeoId.push_back(GeoId);
@@ -5132,6 +5263,15 @@ void ViewProviderSketch::draw(bool temp /*=false*/, bool rebuildinformationlayer
             if (temprepscale > combrepscale)
                 combrepscale = temprepscale;
         }
+
+        if (!cacheable) {
+            cacheItem.geo.reset();
+        }
+        else if (!cached) {
+            cacheItem.geo.reset((*it)->copy());
+            cacheItem.coords.assign(Coords.begin() + coordStart, Coords.end());
+            cacheItem.index.assign(Index.begin() + indexStart, Index.end());
+        }
     }
 
     if ( (combrepscale > (2 * combrepscalehyst)) || (combrepscale < (combrepscalehyst/2)))
@@ -6707,6 +6847,7 @@ void ViewProviderSketch::rebuildConstraintsVisual(void)
     Gui::coinRemoveAllChildren(edit->constrGroup);
     edit->constraNodeMap.clear();
     edit->vConstrType.clear();
+    edit->coinIcons.clear();
 
     for (std::vector<Sketcher::Constraint *>::const_iterator it=constrlist.begin(); it != constrlist.end(); ++it) {
         // root separator for one constraint
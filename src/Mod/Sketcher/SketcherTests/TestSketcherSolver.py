@@ -245,6 +245,108 @@ class TestSketcherSolver(unittest.TestCase):
         ActiveSketch.solve()
         self.failUnless(status == 0) # no redundants/conflicts/convergence issues
 
+    def testDatumUpdate(self):
+        # changing a datum only solves the rectangle that depends on it
+        sketch = self.Doc.addObject('Sketcher::SketchObject','SketchDatum')
+        CreateRectangleSketch(sketch, [0, 0], [20, 10])
+        CreateRectangleSketch(sketch, [50, 0], [30, 30])
+        self.assertEqual(sketch.solve(), 0)
+        other = [sketch.Geometry[i].StartPoint for i in range(4, 8)]
+        width, height = [i for i, c in enumerate(sketch.Constraints)
+                         if c.Type == 'Distance' and c.First in (0, 1)]
+        self.assertEqual(sketch.setDatum(width, App.Units.Quantity('35 mm')), 0)
+        self.assertAlmostEqual(sketch.Geometry[0].length(), 35.0, places=6)
+        self.assertAlmostEqual(sketch.Geometry[1].length(), 10.0, places=6)
+        for i, p in zip(range(4, 8), other):
+            self.assertTrue(sketch.Geometry[i].StartPoint.isEqual(p, 1e-9))
+        # structural changes afterwards still set up the whole sketch
+        sketch.delConstraint(height)
+        sketch.addConstraint(Sketcher.Constraint('Equal', 1, 5))
+        self.assertEqual(sketch.solve(), 0)
+        self.assertAlmostEqual(sketch.Geometry[1].length(), 30.0, places=6)
+        self.Doc.recompute()
+
+    def testSparseJacobian(self):
+        # dense and sparse Jacobian must give the same solution
+        geos = [Part.LineSegment(App.Vector(0.5,-0.5,0), App.Vector(9,0.3,0)),
+                Part.LineSegment(App.Vector(9.2,0.1,0), App.Vector(9.5,8,0)),
+                Part.LineSegment(App.Vector(9.4,8.2,0), App.Vector(1,7.5,0))]
+        constraints = [Sketcher.Constraint('DistanceX', 0, 1, 0.0),
+                       Sketcher.Constraint('DistanceY', 0, 1, 0.0),
+                       Sketcher.Constraint('Coincident', 0, 2, 1, 1),
+                       Sketcher.Constraint('Coincident', 1, 2, 2, 1),
+                       Sketcher.Constraint('Horizontal', 0),
+                       Sketcher.Constraint('Vertical', 1),
+                       Sketcher.Constraint('Horizontal', 2),
+                       Sketcher.Constraint('Distance', 0, 10.0),
+                       Sketcher.Constraint('Distance', 1, 8.0),
+                       Sketcher.Constraint('Distance', 2, 6.0)]
+        points = []
+        for sparse in (False, True):
+            sketch = Sketcher.Sketch()
+            sketch.SparseJacobian = sparse
+            self.assertEqual(sketch.SparseJacobian, sparse)
+            sketch.addGeometry(geos)
+            sketch.addConstraint(constraints)
+            self.assertEqual(sketch.solve(), 0)
+            points.append([g.EndPoint for g in sketch.Geometries])
+        for a, b in zip(points[0], points[1]):
+            self.assertTrue(a.isEqual(b, 1e-9))
+        self.assertTrue(points[1][2].isEqual(App.Vector(4,8,0), 1e-9))
+
+    def testExternalProjection(self):
+        # concurrent and cached projections must match the projection of
+        # each reference on its own
+        shapes = []
+        for i in range(8):
+            box = Part.makeBox(4, 3, 2, App.Vector(i * 6, i % 3, 1 + i % 2))
+            box.rotate(App.Vector(i * 6, 0, 0), App.Vector(0, 0, 1), i * 10)
+            shapes.append(box)
+            shapes.append(Part.makeCylinder(1, 2, App.Vector(i * 6 + 2, 8, 1)))
+        shapes.append(Part.makeBox(40, 2, 2, App.Vector(0, -6, -1)))
+        solid = self.Doc.addObject('Part::Feature', 'Solid')
+        solid.Shape = Part.makeCompound(shapes)
+        # edges of the boxes and cylinders above the sketch plane, and the
+        # side faces of the last box crossing it
+        refs = [('Edge%d' % (i + 1), False) for i in range(len(solid.Shape.Edges) - 12)]
+        refs += [('Face%d' % (len(solid.Shape.Faces) - 5 + i), True) for i in range(4)]
+        self.Doc.recompute()
+
+        def project(refs):
+            sketch = self.Doc.addObject('Sketcher::SketchObject', 'SketchExternal')
+            for sub, intersection in refs:
+                sketch.addExternal(solid.Name, sub, 'intersection' if intersection else '')
+            self.Doc.recompute()
+            return sketch
+
+        def geometry(sketch):
+            result = []
+            for geo in sketch.ExternalGeo[2:]:
+                shape = geo.toShape()
+                result.append((type(geo).__name__, shape.Length,
+                               [v.Point for v in shape.Vertexes]))
+            return result
+
+        def check(geos, expected):
+            self.assertEqual(len(geos), len(expected))
+            for a, b in zip(geos, expected):
+                self.assertEqual(a[0], b[0])
+                self.assertAlmostEqual(a[1], b[1], places=6)
+                self.assertEqual(len(a[2]), len(b[2]))
+                for p, q in zip(a[2], b[2]):
+                    self.assertTrue(p.isEqual(q, 1e-7))
+
+        sketch = project(refs)
+        expected = []
+        for ref in refs:
+            expected += geometry(project([ref]))
+        self.assertGreater(len(expected), 100)
+        check(geometry(sketch), expected)
+        # unchanged references are taken from the projection cache
+        sketch.touch()
+        self.Doc.recompute()
+        check(geometry(sketch), expected)
+
     def tearDown(self):
         #closing doc
         FreeCAD.closeDocument("SketchSolverTest")
@@ -190,6 +190,10 @@ App::DocumentObjectExecReturn *DrawProjGroup::execute(void)
     }
 
     if (ScaleType.isValue("Automatic")) {
+        //fitting the group needs the actual size of every item
+        for (auto& item: getViewsAsDPGI()) {
+            item->waitForHlr();
+        }
         if (!checkFit()) {
             double newScale = autoScale();
             m_lockScale = true;
@@ -958,7 +962,12 @@ void DrawProjGroup::makeViewBbs(DrawProjGroupItem *viewPtrs[10],
     for (int i = 0; i < 10; ++i) {
         bboxes[i] = empty;
         if (viewPtrs[i]) {
-            bboxes[i] = viewPtrs[i]->getBoundingBox();
+            //don't wait for pending projections, the items reposition the
+            //group once they are done, see DrawProjGroupItem::postHlrTasks()
+            Base::BoundBox3d bb = viewPtrs[i]->getLastBoundingBox();
+            if (bb.IsValid()) {
+                bboxes[i] = bb;
+            }
 //            bboxes[i] = viewPtrs[i]->getBoundingBox(viewPtrs[i]->getProjectionCS(Base::Vector3d(0.0, 0.0, 0.0)));
             if (!documentScale) {
                 double scale = 1.0 / viewPtrs[i]->getScale();    //convert bbx to 1:1 scale
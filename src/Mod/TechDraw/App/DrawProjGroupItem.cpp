@@ -145,7 +145,11 @@ App::DocumentObjectExecReturn *DrawProjGroupItem::execute(void)
     }
 
     App::DocumentObjectExecReturn* ret = DrawViewPart::execute();
-    autoPosition();
+    //a background projection positions the group in postHlrTasks() once
+    //the size of this item is known
+    if (!waitingForHlr()) {
+        autoPosition();
+    }
     return ret;
 }
 
@@ -167,6 +171,18 @@ void DrawProjGroupItem::autoPosition()
     }
 }
 
+//the group layout depends on the size of its items, so redo it once the
+//projection of this item is known
+void DrawProjGroupItem::postHlrTasks(void)
+{
+    DrawViewPart::postHlrTasks();
+    auto pgroup = getPGroup();
+    if (pgroup != nullptr) {
+        pgroup->autoPositionChildren();
+        pgroup->requestPaint();
+    }
+}
+
 void DrawProjGroupItem::onDocumentRestored()
 {
 //    Base::Console().Message("DPGI::onDocumentRestored() - %s\n", getNameInDocument());
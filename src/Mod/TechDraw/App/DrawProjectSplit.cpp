@@ -170,63 +170,7 @@ std::vector<TopoDS_Edge> DrawProjectSplit::getEdges(TechDraw::GeometryObject* ge
 
     //HLR algo does not provide all edge intersections for edge endpoints.
     //need to split long edges touched by Vertex of another edge
-    std::vector<splitPoint> splits;
-    std::vector<TopoDS_Edge>::iterator itOuter = origEdges.begin();
-    int iOuter = 0;
-    for (; itOuter != origEdges.end(); ++itOuter, iOuter++) {
-        TopoDS_Vertex v1 = TopExp::FirstVertex((*itOuter));
-        TopoDS_Vertex v2 = TopExp::LastVertex((*itOuter));
-        Bnd_Box sOuter;
-        BRepBndLib::Add(*itOuter, sOuter);
-        sOuter.SetGap(0.1);
-        if (sOuter.IsVoid()) {
-            Base::Console().Message("DPS::Extract Faces - outer Bnd_Box is void\n");
-            continue;
-        }
-        if (DrawUtil::isZeroEdge(*itOuter)) {
-            Base::Console().Message("DPS::extractFaces - outerEdge: %d is ZeroEdge\n",iOuter);   //this is not finding ZeroEdges
-            continue;  //skip zero length edges. shouldn't happen ;)
-        }
-        int iInner = 0;
-        std::vector<TopoDS_Edge>::iterator itInner = faceEdges.begin();
-        for (; itInner != faceEdges.end(); ++itInner,iInner++) {
-            if (iInner == iOuter) {
-                continue;
-            }
-            if (DrawUtil::isZeroEdge((*itInner))) {
-                continue;  //skip zero length edges. shouldn't happen ;)
-            }
-
-            Bnd_Box sInner;
-            BRepBndLib::Add(*itInner, sInner);
-            sInner.SetGap(0.1);
-            if (sInner.IsVoid()) {
-                Base::Console().Log("INFO - DPS::Extract Faces - inner Bnd_Box is void\n");
-                continue;
-            }
-            if (sOuter.IsOut(sInner)) {      //bboxes of edges don't intersect, don't bother
-                continue;
-            }
-
-            double param = -1;
-            if (isOnEdge((*itInner),v1,param,false)) {
-                gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
-                splitPoint s1;
-                s1.i = iInner;
-                s1.v = Base::Vector3d(pnt1.X(),pnt1.Y(),pnt1.Z());
-                s1.param = param;
-                splits.push_back(s1);
-            }
-            if (isOnEdge((*itInner),v2,param,false)) {
-                gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
-                splitPoint s2;
-                s2.i = iInner;
-                s2.v = Base::Vector3d(pnt2.X(),pnt2.Y(),pnt2.Z());
-                s2.param = param;
-                splits.push_back(s2);
-            }
-        } //inner loop
-    }   //outer loop
+    std::vector<splitPoint> splits = findSplitPoints(faceEdges);
 
     std::vector<splitPoint> sorted = sortSplits(splits,true);
     auto last = std::unique(sorted.begin(), sorted.end(), DrawProjectSplit::splitEqual);  //duplicates to back
@@ -241,6 +185,87 @@ std::vector<TopoDS_Edge> DrawProjectSplit::getEdges(TechDraw::GeometryObject* ge
 }
 
 
+//! find the points where an end of an edge touches another edge between its ends.
+//! the edges are binned into a 2d grid over their bounding boxes, so that each
+//! (unique) end point is only checked against the edges in its grid cell.
+std::vector<splitPoint> DrawProjectSplit::findSplitPoints(const std::vector<TopoDS_Edge>& edges)
+{
+    std::vector<splitPoint> splits;
+    std::vector<Bnd_Box> boxes(edges.size());
+    Bnd_Box allBox;
+    int iEdge = 0;
+    for (auto& e: edges) {
+        Bnd_Box& box = boxes[iEdge++];
+        BRepBndLib::Add(e, box);
+        box.SetGap(0.1);
+        if (box.IsVoid()) {
+            Base::Console().Log("INFO - DPS::findSplitPoints - Bnd_Box is void\n");
+            continue;
+        }
+        allBox.Add(box);
+    }
+    if (allBox.IsVoid()) {
+        return splits;
+    }
+
+    double xMin, yMin, zMin, xMax, yMax, zMax;
+    allBox.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    //about one edge per cell, but limit the grid size for huge drawings
+    int cells = std::max(1, std::min(256, (int) std::sqrt((double) edges.size())));
+    double cellX = std::max((xMax - xMin) / cells, Precision::Confusion());
+    double cellY = std::max((yMax - yMin) / cells, Precision::Confusion());
+    auto cellIndex = [cells](double value, double origin, double size) {
+        return std::max(0, std::min(cells - 1, (int) ((value - origin) / size)));
+    };
+
+    std::vector<std::vector<int> > grid(cells * cells);
+    iEdge = 0;
+    for (auto& box: boxes) {
+        if (!box.IsVoid()) {
+            double bxMin, byMin, bzMin, bxMax, byMax, bzMax;
+            box.Get(bxMin, byMin, bzMin, bxMax, byMax, bzMax);
+            int iMax = cellIndex(bxMax, xMin, cellX);
+            int jMax = cellIndex(byMax, yMin, cellY);
+            for (int i = cellIndex(bxMin, xMin, cellX); i <= iMax; i++) {
+                for (int j = cellIndex(byMin, yMin, cellY); j <= jMax; j++) {
+                    grid[i * cells + j].push_back(iEdge);
+                }
+            }
+        }
+        iEdge++;
+    }
+
+    //most end points are shared by several edges, only check them once. an
+    //edge never splits at its own end points (see isOnEdge), so there is no
+    //need to track which edge a point came from.
+    vertexTable ends(Precision::Confusion());
+    for (auto& e: edges) {
+        for (auto& v: {TopExp::FirstVertex(e), TopExp::LastVertex(e)}) {
+            gp_Pnt pnt = BRep_Tool::Pnt(v);
+            int idx = 0;
+            if (!ends.insert(pnt, idx)) {
+                continue;
+            }
+            auto& cell = grid[cellIndex(pnt.X(), xMin, cellX) * cells
+                              + cellIndex(pnt.Y(), yMin, cellY)];
+            for (auto iInner: cell) {
+                if (boxes[iInner].IsOut(pnt)) {
+                    continue;
+                }
+                double param = -1;
+                if (isOnEdge(edges[iInner], v, param, false)) {
+                    splitPoint s;
+                    s.i = iInner;
+                    s.v = Base::Vector3d(pnt.X(), pnt.Y(), pnt.Z());
+                    s.param = param;
+                    splits.push_back(s);
+                }
+            }
+        }
+    }
+    return splits;
+}
+
 //this routine is the big time consumer.  gets called many times (and is slow?))
 //note param gets modified here
 bool DrawProjectSplit::isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, bool allowEnds)
@@ -51,6 +51,7 @@
 #include <gp_Dir.hxx>
 #include <gp_Pln.hxx>
 #include <gp_Pnt.hxx>
+#include <gp_Trsf.hxx>
 #include <GProp_GProps.hxx>
 #include <gp_XYZ.hxx>
 #include <HLRAlgo_Projector.hxx>
@@ -79,6 +80,8 @@
 #include <algorithm>
 #include <cmath>
 
+#include <QtConcurrentRun>
+
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/GroupExtension.h>
@@ -108,6 +111,7 @@
 #include "EdgeWalker.h"
 #include "Geometry.h"
 #include "GeometryObject.h"
+#include "HLRCache.h"
 #include "LineGroup.h"
 #include "ShapeExtractor.h"
 
@@ -127,7 +131,8 @@ PROPERTY_SOURCE_WITH_EXTENSIONS(TechDraw::DrawViewPart,
                                 TechDraw::DrawView)
 
 DrawViewPart::DrawViewPart(void) :
-    geometryObject(0)
+    geometryObject(0),
+    m_waitingForHlr(false)
 {
     static const char *group = "Projection";
     static const char *sgroup = "HLR Parameters";
@@ -172,10 +177,15 @@ DrawViewPart::DrawViewPart(void) :
     geometryObject = nullptr;
     //initialize bbox to non-garbage
     bbox = Base::BoundBox3d(Base::Vector3d(0.0, 0.0, 0.0), 0.0);
+
+    //the watcher lives in the main thread, so the result is installed there
+    QObject::connect(&m_hlrWatcher, &QFutureWatcherBase::finished,
+                     [this]() { onHlrFinished(); });
 }
 
 DrawViewPart::~DrawViewPart()
 {
+    discardHlr();
     removeAllReferencesFromGeom();
     delete geometryObject;
 }
@@ -289,6 +299,15 @@ App::DocumentObjectExecReturn *DrawViewPart::execute(void)
     }
 
     m_saveShape = shape;
+
+    //automatic scale needs the projected size right away, so only views with
+    //a fixed scale are projected in the background
+    if (Preferences::useConcurrentHlr() &&
+        !ScaleType.isValue("Automatic")) {
+        startHlr(shape);
+        return DrawView::execute();
+    }
+
     partExec(shape);
     addShapes2d();
 
@@ -353,6 +372,7 @@ void DrawViewPart::onChanged(const App::Property* prop)
 void DrawViewPart::partExec(TopoDS_Shape shape)
 {
 //    Base::Console().Message("DVP::partExec()\n");
+    discardHlr();
     if (geometryObject) {
         delete geometryObject;
         geometryObject = nullptr;
@@ -410,46 +430,59 @@ void DrawViewPart::addShapes2d(void)
     }
 }
 
-GeometryObject* DrawViewPart::makeGeometryForShape(TopoDS_Shape shape)
-{
-    gp_Pnt inputCenter;
-    Base::Vector3d stdOrg(0.0,0.0,0.0);
-
-    gp_Ax2 viewAxis = getProjectionCS(stdOrg);
+namespace {
 
-    inputCenter = TechDraw::findCentroid(shape,
-                                         viewAxis);
-    Base::Vector3d centroid(inputCenter.X(),
-                            inputCenter.Y(),
-                            inputCenter.Z());
+//edge classes to extract from the projection, with their visibility.
+//collected up front so the projection does not need to read any properties.
+typedef std::vector<std::pair<TechDraw::edgeClass, bool> > EdgeClassList;
 
-    //center shape on origin
-    TopoDS_Shape centeredShape = TechDraw::moveShape(shape,
-                                                     centroid * -1.0);
-    m_saveCentroid = centroid;
-    m_saveShape = centeredShape;
+EdgeClassList edgeClasses(const DrawViewPart* dvp)
+{
+    EdgeClassList result;
+    bool haveIso = dvp->IsoCount.getValue() > 0;
+    result.emplace_back(TechDraw::ecHARD, true);        //always show the hard&outline visible lines
+    result.emplace_back(TechDraw::ecOUTLINE, true);
+    if (dvp->SmoothVisible.getValue()) {
+        result.emplace_back(TechDraw::ecSMOOTH, true);
+    }
+    if (dvp->SeamVisible.getValue()) {
+        result.emplace_back(TechDraw::ecSEAM, true);
+    }
+    if (dvp->IsoVisible.getValue() && haveIso) {
+        result.emplace_back(TechDraw::ecUVISO, true);
+    }
+    if (dvp->HardHidden.getValue()) {
+        result.emplace_back(TechDraw::ecHARD, false);
+        result.emplace_back(TechDraw::ecOUTLINE, false);
+    }
+    if (dvp->SmoothHidden.getValue()) {
+        result.emplace_back(TechDraw::ecSMOOTH, false);
+    }
+    if (dvp->SeamHidden.getValue()) {
+        result.emplace_back(TechDraw::ecSEAM, false);
+    }
+    if (dvp->IsoHidden.getValue() && haveIso) {
+        result.emplace_back(TechDraw::ecUVISO, false);
+    }
+    return result;
+}
 
-    TopoDS_Shape scaledShape = TechDraw::scaleShape(centeredShape,
-                                                    getScale());
-    if (!DrawUtil::fpCompare(Rotation.getValue(),0.0)) {
-        scaledShape = TechDraw::rotateShape(scaledShape,
-                                            viewAxis,
-                                            Rotation.getValue());  //conventional rotation
-     }
-//    BRepTools::Write(scaledShape, "DVPScaled.brep");            //debug
-    GeometryObject* go =  buildGeometryObject(scaledShape,viewAxis);
+TechDraw::GeometryObject* newGeometryObject(DrawViewPart* dvp)
+{
+    TechDraw::GeometryObject* go = new TechDraw::GeometryObject(dvp->getNameInDocument(), dvp);
+    go->setIsoCount(dvp->IsoCount.getValue());
+    go->isPerspective(dvp->Perspective.getValue());
+    go->setFocus(dvp->Focus.getValue());
+    go->usePolygonHLR(dvp->CoarseView.getValue());
     return go;
 }
 
-//note: slightly different than routine with same name in DrawProjectSplit
-TechDraw::GeometryObject* DrawViewPart::buildGeometryObject(TopoDS_Shape shape, gp_Ax2 viewAxis)
+//safe to run outside the main thread
+void projectGeometry(TechDraw::GeometryObject* go,
+                     const TopoDS_Shape& shape,
+                     const gp_Ax2& viewAxis,
+                     const EdgeClassList& classes)
 {
-    TechDraw::GeometryObject* go = new TechDraw::GeometryObject(getNameInDocument(), this);
-    go->setIsoCount(IsoCount.getValue());
-    go->isPerspective(Perspective.getValue());
-    go->setFocus(Focus.getValue());
-    go->usePolygonHLR(CoarseView.getValue());
-
     if (go->usePolygonHLR()){
         go->projectShapeWithPolygonAlgo(shape,
             viewAxis);
@@ -459,58 +492,26 @@ TechDraw::GeometryObject* DrawViewPart::buildGeometryObject(TopoDS_Shape shape,
             viewAxis);
     }
 
-    go->extractGeometry(TechDraw::ecHARD,                   //always show the hard&outline visible lines
-                        true);
-    go->extractGeometry(TechDraw::ecOUTLINE,
-                        true);
-    if (SmoothVisible.getValue()) {
-        go->extractGeometry(TechDraw::ecSMOOTH,
-                            true);
-    }
-    if (SeamVisible.getValue()) {
-        go->extractGeometry(TechDraw::ecSEAM,
-                            true);
-    }
-    if ((IsoVisible.getValue()) && (IsoCount.getValue() > 0)) {
-        go->extractGeometry(TechDraw::ecUVISO,
-                            true);
-    }
-    if (HardHidden.getValue()) {
-        go->extractGeometry(TechDraw::ecHARD,
-                            false);
-        go->extractGeometry(TechDraw::ecOUTLINE,
-                            false);
-    }
-    if (SmoothHidden.getValue()) {
-        go->extractGeometry(TechDraw::ecSMOOTH,
-                            false);
-    }
-    if (SeamHidden.getValue()) {
-        go->extractGeometry(TechDraw::ecSEAM,
-                            false);
-    }
-    if (IsoHidden.getValue() && (IsoCount.getValue() > 0)) {
-        go->extractGeometry(TechDraw::ecUVISO,
-                            false);
+    for (auto& ec: classes) {
+        go->extractGeometry(ec.first,
+                            ec.second);
     }
 
     const std::vector<TechDraw::BaseGeom  *> & edges = go->getEdgeGeometry();
     if (edges.empty()) {
         Base::Console().Log("DVP::buildGO - NO extracted edges!\n");
     }
-    bbox = go->calcBoundingBox();
-    return go;
 }
 
-//! make faces from the existing edge geometry
-void DrawViewPart::extractFaces()
+//make faces from the existing edge geometry. safe to run outside the main thread
+void findFaces(TechDraw::GeometryObject* geometryObject,
+               bool smoothVisible,
+               bool seamVisible,
+               const char* name)
 {
-    if (geometryObject == nullptr) {
-        return;
-    }
     geometryObject->clearFaceGeom();
     const std::vector<TechDraw::BaseGeom*>& goEdges =
-                       geometryObject->getVisibleFaceEdges(SmoothVisible.getValue(),SeamVisible.getValue());
+                       geometryObject->getVisibleFaceEdges(smoothVisible,seamVisible);
     std::vector<TechDraw::BaseGeom*>::const_iterator itEdge = goEdges.begin();
     std::vector<TopoDS_Edge> origEdges;
     for (;itEdge != goEdges.end(); itEdge++) {
@@ -523,69 +524,13 @@ void DrawViewPart::extractFaces()
         if (!DrawUtil::isZeroEdge(e)) {
             nonZero.push_back(e);
         } else {
-            Base::Console().Log("INFO - DVP::extractFaces for %s found ZeroEdge!\n",getNameInDocument());
+            Base::Console().Log("INFO - DVP::extractFaces for %s found ZeroEdge!\n",name);
         }
     }
 
     //HLR algo does not provide all edge intersections for edge endpoints.
     //need to split long edges touched by Vertex of another edge
-    std::vector<splitPoint> splits;
-    std::vector<TopoDS_Edge>::iterator itOuter = nonZero.begin();
-    int iOuter = 0;
-    for (; itOuter != nonZero.end(); ++itOuter, iOuter++) {    //*** itOuter != nonZero.end() - 1
-        TopoDS_Vertex v1 = TopExp::FirstVertex((*itOuter));
-        TopoDS_Vertex v2 = TopExp::LastVertex((*itOuter));
-        Bnd_Box sOuter;
-        BRepBndLib::Add(*itOuter, sOuter);
-        sOuter.SetGap(0.1);
-        if (sOuter.IsVoid()) {
-            Base::Console().Log("DVP::Extract Faces - outer Bnd_Box is void for %s\n",getNameInDocument());
-            continue;
-        }
-        if (DrawUtil::isZeroEdge(*itOuter)) {
-            Base::Console().Log("DVP::extractFaces - outerEdge: %d is ZeroEdge\n",iOuter);   //this is not finding ZeroEdges
-            continue;  //skip zero length edges. shouldn't happen ;)
-        }
-        int iInner = 0;
-        std::vector<TopoDS_Edge>::iterator itInner = nonZero.begin();   //***sb itOuter + 1;
-        for (; itInner != nonZero.end(); ++itInner,iInner++) {
-            if (iInner == iOuter) {
-                continue;
-            }
-            if (DrawUtil::isZeroEdge((*itInner))) {
-                continue;  //skip zero length edges. shouldn't happen ;)
-            }
-
-            Bnd_Box sInner;
-            BRepBndLib::Add(*itInner, sInner);
-            sInner.SetGap(0.1);
-            if (sInner.IsVoid()) {
-                Base::Console().Log("INFO - DVP::Extract Faces - inner Bnd_Box is void for %s\n",getNameInDocument());
-                continue;
-            }
-            if (sOuter.IsOut(sInner)) {      //bboxes of edges don't intersect, don't bother
-                continue;
-            }
-
-            double param = -1;
-            if (DrawProjectSplit::isOnEdge((*itInner),v1,param,false)) {
-                gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
-                splitPoint s1;
-                s1.i = iInner;
-                s1.v = Base::Vector3d(pnt1.X(),pnt1.Y(),pnt1.Z());
-                s1.param = param;
-                splits.push_back(s1);
-            }
-            if (DrawProjectSplit::isOnEdge((*itInner),v2,param,false)) {
-                gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
-                splitPoint s2;
-                s2.i = iInner;
-                s2.v = Base::Vector3d(pnt2.X(),pnt2.Y(),pnt2.Z());
-                s2.param = param;
-                splits.push_back(s2);
-            }
-        } //inner loop
-    }   //outer loop
+    std::vector<splitPoint> splits = DrawProjectSplit::findSplitPoints(nonZero);
 
     std::vector<splitPoint> sorted = DrawProjectSplit::sortSplits(splits,true);
     auto last = std::unique(sorted.begin(), sorted.end(), DrawProjectSplit::splitEqual);  //duplicates to back
@@ -604,7 +549,7 @@ void DrawViewPart::extractFaces()
     ew.loadEdges(newEdges);
     bool success = ew.perform();
     if (!success) {
-        Base::Console().Warning("DVP::extractFaces - %s -Can't make faces from projected edges\n", getNameInDocument());
+        Base::Console().Warning("DVP::extractFaces - %s -Can't make faces from projected edges\n", name);
         return;
     }
     std::vector<TopoDS_Wire> fw = ew.getResultNoDups();
@@ -629,6 +574,228 @@ void DrawViewPart::extractFaces()
     }
 }
 
+} //end anonymous namespace
+
+GeometryObject* DrawViewPart::makeGeometryForShape(TopoDS_Shape shape)
+{
+    gp_Ax2 viewAxis;
+    TopoDS_Shape scaledShape = prepareShape(shape, viewAxis);
+//    BRepTools::Write(scaledShape, "DVPScaled.brep");            //debug
+    GeometryObject* go = newGeometryObject(this);
+    useHlrCache(go);
+    projectGeometry(go, scaledShape, viewAxis, edgeClasses(this));
+    bbox = go->calcBoundingBox();
+    return go;
+}
+
+//! key the projection of go by the identity of the source shapes and the
+//! projection parameters, so it can be shared through the HLR cache.
+//! Changes that leave these alone, like annotations, hidden line visibility
+//! or (for orthographic views) scale, then do not run the HLR again.
+void DrawViewPart::useHlrCache(TechDraw::GeometryObject* go) const
+{
+    int cacheSize = Preferences::hlrCacheSize();
+    HLRCache::instance().setLimit(std::max(cacheSize, 0));
+    if (cacheSize <= 0) {
+        return;
+    }
+
+    std::vector<TopoDS_Shape> sources;
+    std::ostringstream ss;
+    ss.precision(std::numeric_limits<double>::digits10 + 2);
+    for (auto& link: getAllSources()) {
+        TopoDS_Shape s = Part::Feature::getShape(link);
+        if (s.IsNull()) {
+            return;                   //not a plain shape, don't cache
+        }
+        gp_Trsf trsf = s.Location().Transformation();
+        ss << s.TShape().get() << ' ' << static_cast<int>(s.Orientation());
+        for (int row = 1; row <= 3; row++) {
+            for (int col = 1; col <= 4; col++) {
+                ss << ' ' << trsf.Value(row, col);
+            }
+        }
+        ss << ';';
+        sources.push_back(s);
+    }
+    if (sources.empty()) {
+        return;
+    }
+
+    gp_Ax2 viewAxis = getProjectionCS(Base::Vector3d(0.0, 0.0, 0.0));
+    const gp_Dir& dir = viewAxis.Direction();
+    const gp_Dir& xDir = viewAxis.XDirection();
+    ss << dir.X() << ' ' << dir.Y() << ' ' << dir.Z() << ' '
+       << xDir.X() << ' ' << xDir.Y() << ' ' << xDir.Z() << ';'
+       << Rotation.getValue() << ' '
+       << IsoCount.getValue() << ' '
+       << CoarseView.getValue() << ' '
+       << Perspective.getValue();
+    //perspective depends on the focus in model units, and the polygon algo
+    //meshes with a fixed deflection, so these can't simply be scaled
+    if (Perspective.getValue() || CoarseView.getValue()) {
+        ss << ' ' << Focus.getValue() << ' ' << getScale();
+    }
+    go->setHlrCacheKey(ss.str(), sources, getScale());
+}
+
+//! center, scale and rotate the source shape ready for projection
+TopoDS_Shape DrawViewPart::prepareShape(TopoDS_Shape shape, gp_Ax2& viewAxis)
+{
+    gp_Pnt inputCenter;
+    Base::Vector3d stdOrg(0.0,0.0,0.0);
+
+    viewAxis = getProjectionCS(stdOrg);
+
+    inputCenter = TechDraw::findCentroid(shape,
+                                         viewAxis);
+    Base::Vector3d centroid(inputCenter.X(),
+                            inputCenter.Y(),
+                            inputCenter.Z());
+
+    //center shape on origin
+    TopoDS_Shape centeredShape = TechDraw::moveShape(shape,
+                                                     centroid * -1.0);
+    m_saveCentroid = centroid;
+    m_saveShape = centeredShape;
+
+    TopoDS_Shape scaledShape = TechDraw::scaleShape(centeredShape,
+                                                    getScale());
+    if (!DrawUtil::fpCompare(Rotation.getValue(),0.0)) {
+        scaledShape = TechDraw::rotateShape(scaledShape,
+                                            viewAxis,
+                                            Rotation.getValue());  //conventional rotation
+     }
+    return scaledShape;
+}
+
+//note: slightly different than routine with same name in DrawProjectSplit
+TechDraw::GeometryObject* DrawViewPart::buildGeometryObject(TopoDS_Shape shape, gp_Ax2 viewAxis)
+{
+    TechDraw::GeometryObject* go = newGeometryObject(this);
+    projectGeometry(go, shape, viewAxis, edgeClasses(this));
+    bbox = go->calcBoundingBox();
+    return go;
+}
+
+//! make faces from the existing edge geometry
+void DrawViewPart::extractFaces()
+{
+    if (geometryObject == nullptr) {
+        return;
+    }
+    findFaces(geometryObject,
+              SmoothVisible.getValue(),
+              SeamVisible.getValue(),
+              getNameInDocument());
+}
+
+//! project the view in a worker thread. The previous geometry stays in place
+//! until the new one is installed by onHlrFinished(), or by waitForHlr() when
+//! the geometry is needed earlier.
+void DrawViewPart::startHlr(TopoDS_Shape shape)
+{
+    discardHlr();
+
+    gp_Ax2 viewAxis;
+    TopoDS_Shape scaledShape = prepareShape(shape, viewAxis);
+    TechDraw::GeometryObject* go = newGeometryObject(this);
+    useHlrCache(go);
+    EdgeClassList classes = edgeClasses(this);
+    bool faces = false;
+#if MOD_TECHDRAW_HANDLE_FACES
+    faces = handleFaces() && !go->usePolygonHLR();
+#endif //#if MOD_TECHDRAW_HANDLE_FACES
+    bool smoothVisible = SmoothVisible.getValue();
+    bool seamVisible = SeamVisible.getValue();
+    std::string name(getNameInDocument());
+
+    m_hlrError.clear();
+    m_hlrFuture = QtConcurrent::run([=]() {
+        try {
+            projectGeometry(go, scaledShape, viewAxis, classes);
+            if (faces) {
+                findFaces(go, smoothVisible, seamVisible, name.c_str());
+            }
+        }
+        catch (Standard_Failure& e) {
+            const char* msg = e.GetMessageString();
+            m_hlrError = std::string("Projection failed: ") + (msg ? msg : "unknown OCC error");
+        }
+        catch (Base::Exception& e) {
+            m_hlrError = std::string("Projection failed: ") + e.what();
+        }
+        catch (std::exception& e) {
+            m_hlrError = std::string("Projection failed: ") + e.what();
+        }
+        catch (...) {
+            m_hlrError = "Projection failed: unknown exception";
+        }
+        return go;
+    });
+    m_waitingForHlr = true;
+    m_hlrWatcher.setFuture(m_hlrFuture);
+}
+
+//! throw away the result of a pending projection
+void DrawViewPart::discardHlr(void)
+{
+    if (!m_waitingForHlr) {
+        return;
+    }
+    m_waitingForHlr = false;
+    m_hlrFuture.waitForFinished();
+    delete m_hlrFuture.result();
+}
+
+//! install the result of the background projection
+void DrawViewPart::onHlrFinished(void)
+{
+    if (!m_waitingForHlr || !m_hlrFuture.isFinished()) {
+        return;
+    }
+    m_waitingForHlr = false;
+    if (geometryObject) {
+        removeAllReferencesFromGeom();
+        delete geometryObject;
+    }
+    geometryObject = m_hlrFuture.result();
+    bbox = geometryObject->calcBoundingBox();
+
+    //the recompute has already returned, so report the failure of the worker
+    //the same way a failed execute() is reported
+    if (!m_hlrError.empty()) {
+        Base::Console().Error("%s: %s\n", getNameInDocument(), m_hlrError.c_str());
+        if (getDocument()) {
+            getDocument()->setErrorDescription(this, m_hlrError.c_str());
+        }
+    }
+
+    postHlrTasks();
+    requestPaint();
+}
+
+void DrawViewPart::waitForHlr(void) const
+{
+    if (!m_waitingForHlr) {
+        return;
+    }
+    auto self = const_cast<DrawViewPart*>(this);
+    self->m_hlrFuture.waitForFinished();
+    self->onHlrFinished();
+}
+
+//! geometry that is added to the projection after it is installed
+void DrawViewPart::postHlrTasks(void)
+{
+    addCosmeticVertexesToGeom();
+    addCosmeticEdgesToGeom();
+    addCenterLinesToGeom();
+
+    addReferencesToGeom();
+    addShapes2d();
+}
+
 std::vector<TechDraw::DrawHatch*> DrawViewPart::getHatches() const
 {
     std::vector<TechDraw::DrawHatch*> result;
@@ -690,6 +857,7 @@ std::vector<TechDraw::DrawViewBalloon*> DrawViewPart::getBalloons() const
 
 const std::vector<TechDraw::Vertex *> DrawViewPart::getVertexGeometry() const
 {
+    waitForHlr();
     std::vector<TechDraw::Vertex *> result;
     if (geometryObject != nullptr) {
         result = geometryObject->getVertexGeometry();
@@ -699,6 +867,7 @@ const std::vector<TechDraw::Vertex *> DrawViewPart::getVertexGeometry() const
 
 const std::vector<TechDraw::Face *> DrawViewPart::getFaceGeometry() const
 {
+    waitForHlr();
     std::vector<TechDraw::Face*> result;
     if (geometryObject != nullptr) {
         result = geometryObject->getFaceGeometry();
@@ -708,6 +877,7 @@ const std::vector<TechDraw::Face *> DrawViewPart::getFaceGeometry() const
 
 const std::vector<TechDraw::BaseGeom*> DrawViewPart::getEdgeGeometry() const
 {
+    waitForHlr();
     std::vector<TechDraw::BaseGeom  *> result;
     if (geometryObject != nullptr) {
         result = geometryObject->getEdgeGeometry();
@@ -718,6 +888,7 @@ const std::vector<TechDraw::BaseGeom*> DrawViewPart::getEdgeGeometry() const
 //! returns existing BaseGeom of 2D Edge(idx)
 TechDraw::BaseGeom* DrawViewPart::getGeomByIndex(int idx) const
 {
+    waitForHlr();
     const std::vector<TechDraw::BaseGeom *> &geoms = getEdgeGeometry();
     if (geoms.empty()) {
         Base::Console().Log("INFO - getGeomByIndex(%d) - no Edge Geometry. Probably restoring?\n",idx);
@@ -733,6 +904,7 @@ TechDraw::BaseGeom* DrawViewPart::getGeomByIndex(int idx) const
 //! returns existing geometry of 2D Vertex(idx)
 TechDraw::Vertex* DrawViewPart::getProjVertexByIndex(int idx) const
 {
+    waitForHlr();
     const std::vector<TechDraw::Vertex *> &geoms = getVertexGeometry();
     if (geoms.empty()) {
         Base::Console().Log("INFO - getProjVertexByIndex(%d) - no Vertex Geometry. Probably restoring?\n",idx);
@@ -807,6 +979,7 @@ std::vector<TopoDS_Wire> DrawViewPart::getWireForFace(int idx) const
 
 Base::BoundBox3d DrawViewPart::getBoundingBox() const
 {
+    waitForHlr();
     return bbox;
 }
 
@@ -870,6 +1043,7 @@ BaseGeom* DrawViewPart::projectEdge(const TopoDS_Edge& e) const
 
 bool DrawViewPart::hasGeometry(void) const
 {
+    waitForHlr();
     bool result = false;
     if (geometryObject == nullptr) {
         return result;
@@ -957,6 +1131,7 @@ std::vector<DrawViewDetail*> DrawViewPart::getDetailRefs(void) const
 
 const std::vector<TechDraw::BaseGeom  *> DrawViewPart::getVisibleFaceEdges() const
 {
+    waitForHlr();
     return geometryObject->getVisibleFaceEdges(SmoothVisible.getValue(),SeamVisible.getValue());
 }
 
@@ -1190,6 +1365,7 @@ void DrawViewPart::addCosmeticVertexesToGeom(void)
 int DrawViewPart::add1CVToGV(std::string tag)
 {
 //    Base::Console().Message("DVP::add1CVToGV(%s) 2\n", tag.c_str());
+    waitForHlr();
     TechDraw::CosmeticVertex* cv = getCosmeticVertex(tag);
     if (cv == nullptr) {
         Base::Console().Message("DVP::add1CVToGV 2 - cv %s not found\n", tag.c_str());
@@ -1281,6 +1457,7 @@ void DrawViewPart::addCosmeticEdgesToGeom(void)
 int DrawViewPart::add1CEToGE(std::string tag)
 {
 //    Base::Console().Message("CEx::add1CEToGE(%s) 2\n", tag.c_str());
+    waitForHlr();
     TechDraw::CosmeticEdge* ce = getCosmeticEdge(tag);
     if (ce == nullptr) {
         Base::Console().Message("CEx::add1CEToGE 2 - ce %s not found\n", tag.c_str());
@@ -1319,6 +1496,7 @@ void DrawViewPart::clearCenterLines(void)
 int DrawViewPart::add1CLToGE(std::string tag)
 {
 //    Base::Console().Message("CEx::add1CLToGE(%s) 2\n", tag.c_str());
+    waitForHlr();
     TechDraw::CenterLine* cl = getCenterLine(tag);
     if (cl == nullptr) {
         Base::Console().Message("CEx::add1CLToGE 2 - cl %s not found\n", tag.c_str());
@@ -29,6 +29,9 @@
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Wire.hxx>
 
+#include <QFuture>
+#include <QFutureWatcher>
+
 #include <App/DocumentObject.h>
 #include <App/PropertyLinks.h>
 #include <App/PropertyStandard.h>
@@ -131,7 +134,12 @@ public:
     const std::vector<TechDraw::Face*> getFaceGeometry() const;
 
     bool hasGeometry(void) const;
-    TechDraw::GeometryObject* getGeometryObject(void) const { return geometryObject; }
+    TechDraw::GeometryObject* getGeometryObject(void) const { waitForHlr(); return geometryObject; }
+
+    //! true while the projection of this view runs in the background
+    bool waitingForHlr(void) const { return m_waitingForHlr; }
+    //! wait for a background projection and install its result
+    void waitForHlr(void) const;
 
     TechDraw::BaseGeom* getGeomByIndex(int idx) const;               //get existing geom for edge idx in projection
     TechDraw::Vertex* getProjVertexByIndex(int idx) const;           //get existing geom for vertex idx in projection
@@ -139,6 +147,8 @@ public:
     std::vector<TechDraw::BaseGeom*> getFaceEdgesByIndex(int idx) const;  //get edges for face idx in projection
 
     virtual Base::BoundBox3d getBoundingBox() const;
+    //! bounding box of the installed projection, a pending one is not waited for
+    Base::BoundBox3d getLastBoundingBox() const { return bbox; }
     double getBoxX(void) const;
     double getBoxY(void) const;
     virtual QRectF getRect() const override;
@@ -217,9 +227,16 @@ protected:
 
     virtual TechDraw::GeometryObject*  buildGeometryObject(TopoDS_Shape shape, gp_Ax2 viewAxis); //const??
     virtual TechDraw::GeometryObject*  makeGeometryForShape(TopoDS_Shape shape);   //const??
+    TopoDS_Shape prepareShape(TopoDS_Shape shape, gp_Ax2& viewAxis);
+    void useHlrCache(TechDraw::GeometryObject* go) const;
     void partExec(TopoDS_Shape shape);
     virtual void addShapes2d(void);
 
+    void startHlr(TopoDS_Shape shape);
+    void discardHlr(void);
+    void onHlrFinished(void);
+    virtual void postHlrTasks(void);
+
     void extractFaces();
 
     Base::Vector3d shapeCentroid;
@@ -247,6 +264,10 @@ protected:
 private:
     bool nowUnsetting;
 
+    QFuture<TechDraw::GeometryObject*> m_hlrFuture;
+    QFutureWatcher<TechDraw::GeometryObject*> m_hlrWatcher;
+    bool m_waitingForHlr;
+    std::string m_hlrError;     //written by the worker, read once it is finished
 };
 
 typedef App::FeaturePythonT<DrawViewPart> DrawViewPartPython;
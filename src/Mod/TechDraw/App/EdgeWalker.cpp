@@ -43,8 +43,10 @@
 #include <BRepGProp.hxx>
 
 #endif
+#include <algorithm>
 #include <sstream>
 #include <cmath>
+#include <boost/functional/hash.hpp>
 
 #include <Base/Console.h>
 #include <Base/Exception.h>
@@ -94,6 +96,78 @@ void edgeVisitor::setGraph(TechDraw::graph& g)
     m_g = g;
 }
 
+//*******************************************************
+//* vertexTable methods
+//*******************************************************
+
+vertexTable::vertexTable(double tolerance) :
+    m_tolerance(tolerance)
+{
+}
+
+std::size_t vertexTable::cellHash::operator()(const cellKey& key) const
+{
+    std::size_t seed = 0;
+    for (auto k: key) {
+        boost::hash_combine(seed, k);
+    }
+    return seed;
+}
+
+vertexTable::cellKey vertexTable::cellOf(const gp_Pnt& pt) const
+{
+    return {{ (long long) std::floor(pt.X() / m_tolerance),
+              (long long) std::floor(pt.Y() / m_tolerance),
+              (long long) std::floor(pt.Z() / m_tolerance) }};
+}
+
+int vertexTable::add(const gp_Pnt& pt)
+{
+    int index = (int) m_points.size();
+    m_points.push_back(pt);
+    m_cells[cellOf(pt)].push_back(index);
+    return index;
+}
+
+bool vertexTable::insert(const gp_Pnt& pt, int& index)
+{
+    index = find(pt);
+    if (index >= 0) {
+        return false;
+    }
+    index = add(pt);
+    return true;
+}
+
+int vertexTable::find(const gp_Pnt& pt) const
+{
+    //cells are as big as the tolerance, so a point within tolerance is
+    //either in the same cell or in one of the adjacent ones.
+    int result = -1;
+    cellKey center = cellOf(pt);
+    cellKey key;
+    for (long long dx = -1; dx <= 1; dx++) {
+        key[0] = center[0] + dx;
+        for (long long dy = -1; dy <= 1; dy++) {
+            key[1] = center[1] + dy;
+            for (long long dz = -1; dz <= 1; dz++) {
+                key[2] = center[2] + dz;
+                auto it = m_cells.find(key);
+                if (it == m_cells.end()) {
+                    continue;
+                }
+                for (auto idx: it->second) {
+                    if ((result < 0 || idx < result) &&
+                        m_points[idx].IsEqual(pt, m_tolerance)) {
+                        result = idx;
+                    }
+                }
+            }
+        }
+    }
+    return result;
+}
+
 //*******************************************************
 //* EdgeWalker methods
 //*******************************************************
@@ -309,20 +383,14 @@ std::vector<TopoDS_Vertex> EdgeWalker:: makeUniqueVList(std::vector<TopoDS_Edge>
 {
     //Base::Console().Message("TRACE - EW::makeUniqueVList()\n");
     std::vector<TopoDS_Vertex> uniqueVert;
+    vertexTable table(EWTOLERANCE);
+    int idx = 0;
     for(auto& e:edges) {
         TopoDS_Vertex v1 = TopExp::FirstVertex(e);
         TopoDS_Vertex v2 = TopExp::LastVertex(e);
-        bool addv1 = true;
-        bool addv2 = true;
-        for (auto v:uniqueVert) {
-            if (DrawUtil::isSamePoint(v,v1,EWTOLERANCE))
-                addv1 = false;
-            if (DrawUtil::isSamePoint(v,v2,EWTOLERANCE))
-                addv2 = false;
-        }
-        if (addv1)
+        if (table.insert(BRep_Tool::Pnt(v1), idx))
             uniqueVert.push_back(v1);
-        if (addv2)
+        if (table.insert(BRep_Tool::Pnt(v2), idx))
             uniqueVert.push_back(v2);
     }
     return uniqueVert;
@@ -334,12 +402,16 @@ std::vector<WalkerEdge> EdgeWalker::makeWalkerEdges(std::vector<TopoDS_Edge> edg
 {
 //    Base::Console().Message("TRACE - EW::makeWalkerEdges()\n");
     m_saveInEdges = edges;
+    vertexTable table(EWTOLERANCE);
+    for (auto& v: verts) {
+        table.add(BRep_Tool::Pnt(v));
+    }
+
     std::vector<WalkerEdge> walkerEdges;
-    for (auto e:edges) {
-        TopoDS_Vertex ev1 = TopExp::FirstVertex(e);
-        TopoDS_Vertex ev2 = TopExp::LastVertex(e);
-        int v1dx = findUniqueVert(ev1, verts);
-        int v2dx = findUniqueVert(ev2, verts);
+    for (auto& e:edges) {
+        //same result as findUniqueVert, without the linear search
+        int v1dx = std::max(table.find(BRep_Tool::Pnt(TopExp::FirstVertex(e))), 0);
+        int v2dx = std::max(table.find(BRep_Tool::Pnt(TopExp::LastVertex(e))), 0);
         WalkerEdge we;
         we.v1 = v1dx;
         we.v2 = v2dx;
@@ -414,25 +486,30 @@ std::vector<embedItem> EdgeWalker::makeEmbedding(const std::vector<TopoDS_Edge>
 //                            edges.size(),uniqueVList.size());
     std::vector<embedItem> result;
 
-    int iv = 0;
+    vertexTable table(EWTOLERANCE);
     for (auto& v: uniqueVList) {
-        int ie = 0;
-        std::vector<incidenceItem> iiList;
-        for (auto& e: edges) {
-            double angle = 0;
-            if (DrawUtil::isFirstVert(e,v,EWTOLERANCE)) {
-                angle = DrawUtil::angleWithX(e,v,EWTOLERANCE);
-                incidenceItem ii(ie, angle, m_saveWalkerEdges[ie].ed);
-                iiList.push_back(ii);
-            } else if (DrawUtil::isLastVert(e,v,EWTOLERANCE)) {
-                angle = DrawUtil::angleWithX(e,v,EWTOLERANCE);
-                incidenceItem ii(ie, angle, m_saveWalkerEdges[ie].ed);
-                iiList.push_back(ii);
-            } else {
-                //Base::Console().Message("TRACE - EW::makeEmbedding - neither first nor last\n");
-            }
-            ie++;
-       }
+        table.add(BRep_Tool::Pnt(v));
+    }
+
+    //collect the incident edges of each vertex in one pass over the edges
+    std::vector<std::vector<incidenceItem> > iiLists(uniqueVList.size());
+    int ie = 0;
+    for (auto& e: edges) {
+        int iv1 = table.find(BRep_Tool::Pnt(TopExp::FirstVertex(e)));
+        int iv2 = table.find(BRep_Tool::Pnt(TopExp::LastVertex(e)));
+        if (iv1 >= 0) {
+            double angle = DrawUtil::angleWithX(e,uniqueVList[iv1],EWTOLERANCE);
+            iiLists[iv1].push_back(incidenceItem(ie, angle, m_saveWalkerEdges[ie].ed));
+        }
+        if (iv2 >= 0 && iv2 != iv1) {
+            double angle = DrawUtil::angleWithX(e,uniqueVList[iv2],EWTOLERANCE);
+            iiLists[iv2].push_back(incidenceItem(ie, angle, m_saveWalkerEdges[ie].ed));
+        }
+        ie++;
+    }
+
+    int iv = 0;
+    for (auto& iiList: iiLists) {
        //sort incidenceList by angle
        iiList = embedItem::sortIncidenceList(iiList,  false);
        embedItem embed(iv, iiList);
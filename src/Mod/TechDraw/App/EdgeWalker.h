@@ -28,6 +28,8 @@
 #ifndef TECHDRAW_EDGEWALKER_H
 #define TECHDRAW_EDGEWALKER_H
 
+#include <array>
+#include <unordered_map>
 #include <vector>
 #include <boost_graph_adjacency_list.hpp>
 #include <boost/graph/properties.hpp>
@@ -41,6 +43,7 @@
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Wire.hxx>
+#include <gp_Pnt.hxx>
 
 namespace TechDraw {
 //using namespace boost;
@@ -151,6 +154,35 @@ public:
     static std::vector<incidenceItem> sortIncidenceList (std::vector<incidenceItem> &list, bool ascend);
 };
 
+//! table of points hashed by tolerance sized grid cells. finds coincident
+//! points by checking the neighbouring cells instead of every other point.
+class vertexTable
+{
+public:
+    explicit vertexTable(double tolerance);
+
+    //! add pt to the table and return its index
+    int add(const gp_Pnt& pt);
+    //! add pt unless a point within tolerance is already present. index
+    //! receives the index of pt or the existing point. returns true if added.
+    bool insert(const gp_Pnt& pt, int& index);
+    //! index of the first added point within tolerance of pt, or -1
+    int find(const gp_Pnt& pt) const;
+    const gp_Pnt& point(int index) const { return m_points[index]; }
+    int size(void) const { return (int) m_points.size(); }
+
+private:
+    typedef std::array<long long, 3> cellKey;
+    struct cellHash {
+        std::size_t operator()(const cellKey& key) const;
+    };
+    cellKey cellOf(const gp_Pnt& pt) const;
+
+    double m_tolerance;
+    std::vector<gp_Pnt> m_points;
+    std::unordered_map<cellKey, std::vector<int>, cellHash> m_cells;
+};
+
 
 class EdgeWalker
 {
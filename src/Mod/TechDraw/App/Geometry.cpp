@@ -69,6 +69,7 @@
 #include <BRepAdaptor_HCurve.hxx>
 #endif
 #include <cmath>
+#include <mutex>
 #endif  // #ifndef _PreComp_
 
 #include <Base/Console.h>
@@ -1521,6 +1522,10 @@ void Vertex::Restore(Base::XMLReader &reader)
 
 void Vertex::createNewTag()
 {
+    // Vertices are also created by the HLR worker threads of DrawViewPart
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+
     // Initialize a random number generator, to avoid Valgrind false positives.
     static boost::mt19937 ran;
     static bool seeded = false;
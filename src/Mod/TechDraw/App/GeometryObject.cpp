@@ -78,6 +78,7 @@
 
 #include "DrawUtil.h"
 #include "GeometryObject.h"
+#include "HLRCache.h"
 #include "DrawViewPart.h"
 #include "DrawViewDetail.h"
 
@@ -95,7 +96,8 @@ GeometryObject::GeometryObject(const string& parent, TechDraw::DrawView* parentO
     m_isoCount(0),
     m_isPersp(false),
     m_focus(100.0),
-    m_usePolygonHLR(false)
+    m_usePolygonHLR(false),
+    m_hlrCacheScale(1.0)
 
 {
 }
@@ -170,6 +172,58 @@ void GeometryObject::clear()
     edgeGeom.clear();
 }
 
+void GeometryObject::setHlrCacheKey(const std::string& key,
+                                    const std::vector<TopoDS_Shape>& sources,
+                                    double scale)
+{
+    m_hlrCacheKey = key;
+    m_hlrCacheSources = sources;
+    m_hlrCacheScale = scale;
+}
+
+//! take the HLR output from the cache if this projection was made before
+bool GeometryObject::findCachedHlr(void)
+{
+    if (m_hlrCacheKey.empty()) {
+        return false;
+    }
+    HLRResult cached;
+    if (!HLRCache::instance().find(m_hlrCacheKey, m_hlrCacheScale, cached)) {
+        return false;
+    }
+    visHard    = cached.visHard;
+    visOutline = cached.visOutline;
+    visSmooth  = cached.visSmooth;
+    visSeam    = cached.visSeam;
+    visIso     = cached.visIso;
+    hidHard    = cached.hidHard;
+    hidOutline = cached.hidOutline;
+    hidSmooth  = cached.hidSmooth;
+    hidSeam    = cached.hidSeam;
+    hidIso     = cached.hidIso;
+    Base::Console().Log("GO::projectShape - %s reused cached projection\n", m_parentName.c_str());
+    return true;
+}
+
+void GeometryObject::cacheHlr(void)
+{
+    if (m_hlrCacheKey.empty()) {
+        return;
+    }
+    HLRResult result;
+    result.visHard    = visHard;
+    result.visOutline = visOutline;
+    result.visSmooth  = visSmooth;
+    result.visSeam    = visSeam;
+    result.visIso     = visIso;
+    result.hidHard    = hidHard;
+    result.hidOutline = hidOutline;
+    result.hidSmooth  = hidSmooth;
+    result.hidSeam    = hidSeam;
+    result.hidIso     = hidIso;
+    HLRCache::instance().add(m_hlrCacheKey, m_hlrCacheScale, result, m_hlrCacheSources);
+}
+
 //!set up a hidden line remover and project a shape with it
 void GeometryObject::projectShape(const TopoDS_Shape& input,
                                   const gp_Ax2& viewAxis)
@@ -178,8 +232,12 @@ void GeometryObject::projectShape(const TopoDS_Shape& input,
    // Clear previous Geometry
     clear();
 //    DrawUtil::dumpCS("GO::projectShape - VA in", viewAxis);    //debug
+    if (findCachedHlr()) {
+        return;
+    }
 
     auto start = chrono::high_resolution_clock::now();
+    bool failed = false;
 
     Handle(HLRBRep_Algo) brep_hlr = NULL;
     try {
@@ -200,9 +258,11 @@ void GeometryObject::projectShape(const TopoDS_Shape& input,
     catch (const Standard_Failure& e) {
         Base::Console().Error("GO::projectShape - OCC error - %s - while projecting shape\n",
                               e.GetMessageString());
+        failed = true;
         }
     catch (...) {
         Base::Console().Error("GeometryObject::projectShape - unknown error occurred while projecting shape\n");
+        failed = true;
 //        throw Base::RuntimeError("GeometryObject::projectShape - unknown error occurred while projecting shape");
     }
 
@@ -262,15 +322,21 @@ void GeometryObject::projectShape(const TopoDS_Shape& input,
     catch (const Standard_Failure& e) {
         Base::Console().Error("GO::projectShape - OCC error - %s - while extracting edges\n",
                               e.GetMessageString());
+        failed = true;
     }
     catch (...) {
         Base::Console().Error("GO::projectShape - unknown error while extracting edges\n");
+        failed = true;
 //        throw Base::RuntimeError("GeometryObject::projectShape - error occurred while extracting edges");
     }
     end   = chrono::high_resolution_clock::now();
     diff  = end - start;
     diffOut = chrono::duration <double, milli> (diff).count();
     Base::Console().Log("TIMING - %s GO spent: %.3f millisecs in hlrToShape and BuildCurves\n",m_parentName.c_str(),diffOut);
+
+    if (!failed) {
+        cacheHlr();
+    }
 }
 
 //mirror a shape thru XZ plane for Qt's inverted Y coordinate
@@ -299,19 +365,24 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input,
 {
     // Clear previous Geometry
     clear();
+    if (findCachedHlr()) {
+        return;
+    }
+    bool failed = false;
     
     //work around for Mantis issue #3332
     //if 3332 gets fixed in OCC, this will produce shifted views and will need
     //to be reverted.
-    TopoDS_Shape inCopy;
+    //The faces are meshed below, and moveShape() only relocates the shape,
+    //sharing its faces with the document and other views projected
+    //concurrently. Mesh a real copy instead.
+    BRepBuilderAPI_Copy BuilderCopy(input);
+    TopoDS_Shape inCopy = BuilderCopy.Shape();
     if (!m_isPersp) {
         gp_Pnt gCenter = findCentroid(input,
                                       viewAxis);
         Base::Vector3d motion(-gCenter.X(),-gCenter.Y(),-gCenter.Z());
-        inCopy = moveShape(input,motion);
-    } else {
-        BRepBuilderAPI_Copy BuilderCopy(input);
-        inCopy = BuilderCopy.Shape();
+        inCopy = moveShape(inCopy,motion);
     }
 
     auto start = chrono::high_resolution_clock::now();
@@ -343,9 +414,11 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input,
     catch (const Standard_Failure& e) {
         Base::Console().Error("GO::projectShapeWithPolygonAlgo - OCC error - %s - while projecting shape\n",
                               e.GetMessageString());
+        failed = true;
     }
     catch (...) {
         Base::Console().Error("GO::projectShapeWithPolygonAlgo - unknown error while projecting shape\n");
+        failed = true;
 //        throw Base::RuntimeError("GeometryObject::projectShapeWithPolygonAlgo  - error occurred while projecting shape");
 //        Standard_Failure::Raise("GeometryObject::projectShapeWithPolygonAlgo  - error occurred while projecting shape");
     }
@@ -391,9 +464,11 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input,
     catch (const Standard_Failure& e) {
         Base::Console().Error("GO::projectShapeWithPolygonAlgo - OCC error - %s - while extracting edges\n",
                               e.GetMessageString());
+        failed = true;
     }
     catch (...) {
         Base::Console().Error("GO::projectShapeWithPolygonAlgo - - error occurred while extracting edges\n");
+        failed = true;
 //        throw Base::RuntimeError("GeometryObject::projectShapeWithPolygonAlgo  - error occurred while extracting edges");
 //        Standard_Failure::Raise("GeometryObject::projectShapeWithPolygonAlgo - error occurred while extracting edges");
     }
@@ -401,6 +476,10 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input,
     auto diff = end - start;
     double diffOut = chrono::duration <double, milli>(diff).count();
     Base::Console().Log("TIMING - %s GO spent: %.3f millisecs in HLRBRep_PolyAlgo & co\n", m_parentName.c_str(), diffOut);
+
+    if (!failed) {
+        cacheHlr();
+    }
 }
 
 TopoDS_Shape GeometryObject::projectFace(const TopoDS_Shape &face,
@@ -130,6 +130,10 @@ public:
     bool usePolygonHLR(void) const { return m_usePolygonHLR; }
     void setFocus(double f) { m_focus = f; }
     double getFocus(void) { return m_focus; }
+    //! reuse and feed the HLR cache when projecting. see HLRCache
+    void setHlrCacheKey(const std::string& key,
+                        const std::vector<TopoDS_Shape>& sources,
+                        double scale);
     void pruneVertexGeom(Base::Vector3d center, double radius);
 
     //dupl mirrorShape???
@@ -198,12 +202,19 @@ protected:
 
     bool findVertex(Base::Vector3d v);
 
+    bool findCachedHlr(void);
+    void cacheHlr(void);
+
     std::string m_parentName;
     TechDraw::DrawView* m_parent;
     int m_isoCount;
     bool m_isPersp;
     double m_focus;
     bool m_usePolygonHLR;
+
+    std::string m_hlrCacheKey;
+    std::vector<TopoDS_Shape> m_hlrCacheSources;
+    double m_hlrCacheScale;
 };
 
 } //namespace TechDraw
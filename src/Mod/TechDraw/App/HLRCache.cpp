@@ -0,0 +1,150 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <BRepBuilderAPI_Transform.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_Trsf.hxx>
+#include <Standard_Failure.hxx>
+#endif
+
+#include <Base/Console.h>
+
+#include "DrawUtil.h"
+#include "HLRCache.h"
+
+using namespace TechDraw;
+
+namespace {
+
+TopoDS_Shape scaleCompound(const TopoDS_Shape& s, double factor)
+{
+    if (s.IsNull()) {
+        return s;
+    }
+    gp_Trsf scaleTransform;
+    scaleTransform.SetScale(gp_Pnt(0.0, 0.0, 0.0), factor);
+    BRepBuilderAPI_Transform mkTrf(s, scaleTransform);
+    return mkTrf.Shape();
+}
+
+} //end anonymous namespace
+
+HLRCache::HLRCache() :
+    m_limit(0)
+{
+}
+
+HLRCache& HLRCache::instance()
+{
+    static HLRCache cache;
+    return cache;
+}
+
+bool HLRCache::find(const std::string& key, double scale, HLRResult& result)
+{
+    double factor = 1.0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_index.find(key);
+        if (it == m_index.end()) {
+            return false;
+        }
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        result = it->second->result;
+        factor = scale / it->second->scale;
+    }
+
+    if (DrawUtil::fpCompare(factor, 1.0)) {
+        return true;
+    }
+
+    //transform outside the lock, other views may be looking up meanwhile
+    try {
+        result.visHard = scaleCompound(result.visHard, factor);
+        result.visOutline = scaleCompound(result.visOutline, factor);
+        result.visSmooth = scaleCompound(result.visSmooth, factor);
+        result.visSeam = scaleCompound(result.visSeam, factor);
+        result.visIso = scaleCompound(result.visIso, factor);
+        result.hidHard = scaleCompound(result.hidHard, factor);
+        result.hidOutline = scaleCompound(result.hidOutline, factor);
+        result.hidSmooth = scaleCompound(result.hidSmooth, factor);
+        result.hidSeam = scaleCompound(result.hidSeam, factor);
+        result.hidIso = scaleCompound(result.hidIso, factor);
+    }
+    catch (const Standard_Failure& e) {
+        Base::Console().Log("HLRCache::find - OCC error - %s - while scaling projection\n",
+                            e.GetMessageString());
+        return false;
+    }
+    return true;
+}
+
+void HLRCache::add(const std::string& key,
+                   double scale,
+                   const HLRResult& result,
+                   const std::vector<TopoDS_Shape>& sources)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_limit == 0) {
+        return;
+    }
+    auto it = m_index.find(key);
+    if (it != m_index.end()) {
+        m_entries.erase(it->second);
+        m_index.erase(it);
+    }
+    m_entries.push_front(Entry{key, scale, result, sources});
+    m_index[key] = m_entries.begin();
+    trim();
+}
+
+void HLRCache::setLimit(std::size_t limit)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_limit = limit;
+    trim();
+}
+
+std::size_t HLRCache::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+void HLRCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_index.clear();
+    m_entries.clear();
+}
+
+//caller holds the lock
+void HLRCache::trim()
+{
+    while (m_entries.size() > m_limit) {
+        m_index.erase(m_entries.back().key);
+        m_entries.pop_back();
+    }
+}
@@ -0,0 +1,105 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef TECHDRAW_HLRCACHE_H
+#define TECHDRAW_HLRCACHE_H
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <TopoDS_Shape.hxx>
+
+namespace TechDraw
+{
+
+//! edge compounds produced by hidden line removal
+struct HLRResult
+{
+    TopoDS_Shape visHard;
+    TopoDS_Shape visOutline;
+    TopoDS_Shape visSmooth;
+    TopoDS_Shape visSeam;
+    TopoDS_Shape visIso;
+    TopoDS_Shape hidHard;
+    TopoDS_Shape hidOutline;
+    TopoDS_Shape hidSmooth;
+    TopoDS_Shape hidSeam;
+    TopoDS_Shape hidIso;
+};
+
+/** Cache of hidden line removal results shared by all views.
+ *
+ * Entries are keyed by the identity of the source shapes and the projection
+ * parameters (see DrawViewPart::useHlrCache()), so views that show the same
+ * shapes from the same direction share one projection, and a view that is
+ * recomputed without changes to its source reuses its previous projection.
+ * Orthographic projections are cached with the scale they were made at and
+ * are scaled to fit on lookup.
+ *
+ * An entry holds on to its source shapes, so that the addresses in its key
+ * can not be reused by other shapes while the entry exists. The least
+ * recently used entries are dropped once the cache is full.
+ *
+ * The cache may be used from the HLR worker threads.
+ */
+class TechDrawExport HLRCache
+{
+public:
+    static HLRCache& instance();
+
+    //! look up a projection and scale it from the cached scale to \a scale
+    bool find(const std::string& key, double scale, HLRResult& result);
+    void add(const std::string& key,
+             double scale,
+             const HLRResult& result,
+             const std::vector<TopoDS_Shape>& sources);
+
+    //! maximum number of entries, 0 disables the cache
+    void setLimit(std::size_t limit);
+    std::size_t size() const;
+    void clear();
+
+private:
+    HLRCache();
+
+    struct Entry {
+        std::string key;
+        double scale;
+        HLRResult result;
+        std::vector<TopoDS_Shape> sources;
+    };
+    typedef std::list<Entry> EntryList;
+
+    void trim();
+
+    EntryList m_entries;                //most recently used first
+    std::unordered_map<std::string, EntryList::iterator> m_index;
+    std::size_t m_limit;
+    mutable std::mutex m_mutex;
+};
+
+} //namespace TechDraw
+
+#endif  // #ifndef TECHDRAW_HLRCACHE_H
@@ -148,6 +148,26 @@ bool Preferences::keepPagesUpToDate()
     return autoUpdate;
 }
 
+//project views in a worker thread instead of blocking the recompute
+bool Preferences::useConcurrentHlr()
+{
+    Base::Reference<ParameterGrp> hGrp = App::GetApplication().GetUserParameter().
+                                         GetGroup("BaseApp")->GetGroup("Preferences")->
+                                         GetGroup("Mod/TechDraw/General");
+    bool result = hGrp->GetBool("ConcurrentHLR", true);
+    return result;
+}
+
+//number of projections kept for reuse. 0 turns the HLR cache off
+int Preferences::hlrCacheSize()
+{
+    Base::Reference<ParameterGrp> hGrp = App::GetApplication().GetUserParameter().
+                                         GetGroup("BaseApp")->GetGroup("Preferences")->
+                                         GetGroup("Mod/TechDraw/General");
+    int result = hGrp->GetInt("HLRCacheSize", 16);
+    return result;
+}
+
 bool Preferences::useGlobalDecimals()
 {
     bool result = false;
@@ -57,6 +57,8 @@ static double      vertexScale();
 
 static bool        useGlobalDecimals();
 static bool        keepPagesUpToDate();
+static bool        useConcurrentHlr();
+static int         hlrCacheSize();
 
 static int         projectionAngle();
 static int         lineGroup();
@@ -444,6 +444,11 @@ void QGIViewPart::drawViewPart()
         return;
     }
 //    Base::Console().Message("QGIVP::DVP() - %s / %s\n", viewPart->getNameInDocument(), viewPart->Label.getValue());
+    if (viewPart->waitingForHlr()) {
+        //keep the current drawing until the new projection is ready. the view
+        //asks to be repainted when it is.
+        return;
+    }
     if (!viewPart->hasGeometry()) {
         removePrimitives();                      //clean the slate
         removeDecorations();
@@ -95,3 +95,58 @@ class TechDrawTestCases(unittest.TestCase):
             print("TD DrawViewBalloon test passed")
         else:
             print("TD DrawViewBalloon test failed")
+
+
+class TechDrawConcurrentCases(unittest.TestCase):
+    def setUp(self):
+        self.params = App.ParamGet("User parameter:BaseApp/Preferences/Mod/TechDraw/General")
+        self.concurrent = self.params.GetBool("ConcurrentHLR", True)
+        self.cacheSize = self.params.GetInt("HLRCacheSize", 16)
+        # every recompute has to project, not reuse an earlier result
+        self.params.SetInt("HLRCacheSize", 0)
+        self.doc = App.newDocument("TDConcurrent")
+        box = self.doc.addObject("Part::Box", "Box")
+        cyl = self.doc.addObject("Part::Cylinder", "Cylinder")
+        cyl.Radius = 3
+        cyl.Height = 20
+        cut = self.doc.addObject("Part::Cut", "Cut")
+        cut.Base = box
+        cut.Tool = cyl
+        self.page = self.doc.addObject("TechDraw::DrawPage", "Page")
+        self.views = []
+        for d in [(0, 0, 1), (1, 0, 0), (0, -1, 0), (1, 1, 1), (-1, 2, 1)]:
+            view = self.doc.addObject("TechDraw::DrawViewPart", "View")
+            self.page.addView(view)
+            view.Source = [cut]
+            view.Direction = App.Vector(*d)
+            view.ScaleType = "Custom"
+            view.Scale = 2.0
+            self.views.append(view)
+
+    def projections(self, concurrent):
+        self.params.SetBool("ConcurrentHLR", concurrent)
+        for view in self.views:
+            view.touch()
+        self.doc.recompute()
+        result = []
+        for view in self.views:
+            visible = view.getVisibleEdges()
+            hidden = view.getHiddenEdges()
+            result.append((len(visible), sum(e.Length for e in visible),
+                           len(hidden), sum(e.Length for e in hidden)))
+            self.assertNotIn("Invalid", view.State)
+        return result
+
+    def testConcurrentMatchesSerial(self):
+        serial = self.projections(False)
+        concurrent = self.projections(True)
+        for s, c in zip(serial, concurrent):
+            self.assertEqual(s[0], c[0])
+            self.assertAlmostEqual(s[1], c[1], places=6)
+            self.assertEqual(s[2], c[2])
+            self.assertAlmostEqual(s[3], c[3], places=6)
+
+    def tearDown(self):
+        App.closeDocument(self.doc.Name)
+        self.params.SetBool("ConcurrentHLR", self.concurrent)
+        self.params.SetInt("HLRCacheSize", self.cacheSize)
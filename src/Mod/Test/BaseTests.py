@@ -156,6 +156,27 @@ class ParameterTestCase(unittest.TestCase):
         self.TestPar.RemString("44")
         self.failUnless(self.TestPar.GetString("44","hallo") == "hallo","Deletion error at String")
 
+    def testClearAndImport(self):
+        grp = self.TestPar.GetGroup("ClearAndImport")
+        grp.SetInt("Int", 1)
+        grp.SetString("String", "abc")
+        self.assertEqual(grp.GetInt("Int"), 1)
+        grp.Clear()
+        self.assertEqual(grp.GetInt("Int", 2), 2)
+        self.assertEqual(grp.GetString("String", "def"), "def")
+
+        grp.SetFloat("Float", 1.5)
+        grp.SetBool("Bool", True)
+        path = tempfile.gettempdir() + os.sep + "ClearAndImport.FCParam"
+        grp.Export(path)
+        grp.SetFloat("Float", 2.5)
+        grp.RemBool("Bool")
+        grp.Import(path)
+        os.remove(path)
+        self.assertEqual(grp.GetFloat("Float"), 1.5)
+        self.assertEqual(grp.GetBool("Bool"), True)
+        self.TestPar.RemGroup("ClearAndImport")
+
     def testAngle(self):
         v1 = FreeCAD.Vector(0,0,0.000001)
         v2 = FreeCAD.Vector(0,0.000001,0)
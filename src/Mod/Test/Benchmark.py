@@ -0,0 +1,582 @@
+#***************************************************************************
+#*   Copyright (c) 2026 FreeCAD Project Association                        *
+#*                                                                         *
+#*   This file is part of the FreeCAD CAx development system.              *
+#*                                                                         *
+#*   This program is free software; you can redistribute it and/or modify  *
+#*   it under the terms of the GNU Lesser General Public License (LGPL)    *
+#*   as published by the Free Software Foundation; either version 2 of     *
+#*   the License, or (at your option) any later version.                   *
+#*   for detail see the LICENCE text file.                                 *
+#*                                                                         *
+#*   FreeCAD is distributed in the hope that it will be useful,            *
+#*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+#*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+#*   GNU Library General Public License for more details.                  *
+#*                                                                         *
+#*   You should have received a copy of the GNU Library General Public     *
+#*   License along with FreeCAD; if not, write to the Free Software        *
+#*   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+#*   USA                                                                   *
+#*                                                                         *
+#***************************************************************************/
+
+"""Headless benchmark suite
+
+Runs a set of reproducible synthetic workloads and reports timing and peak
+memory in JSON. No GUI is needed, run it with e.g.
+
+    FreeCADCmd -c "import Benchmark; Benchmark.main()"
+    FreeCADCmd -c "import Benchmark; Benchmark.main(['--output', '/tmp/bench.json', 'sketch', 'spreadsheet'])"
+
+or as a script with a Python interpreter that can import FreeCAD,
+
+    python3 Benchmark.py --scale 0.1 mesh sketch
+
+FreeCADCmd treats extra command line arguments as files to open, so inside
+FreeCAD the options must be given to main() directly.
+
+or from the Python console,
+
+    import Benchmark
+    Benchmark.run(['mesh'], scale=0.1)
+
+Each workload consists of an untimed setup and one or more timed phases. The
+sizes of all workloads are multiplied by 'scale', so that a quick smoke run
+uses the same code as the nightly run. Workloads whose module is not built
+are reported with status 'skipped'.
+"""
+
+import FreeCAD
+import gc
+import json
+import math
+import os
+import platform
+import shutil
+import sys
+import tempfile
+import time
+
+__all__ = ['run', 'main', 'workloads']
+
+
+#---------------------------------------------------------------------------
+# peak memory
+#---------------------------------------------------------------------------
+
+def _resetPeakMemory():
+    """Reset the peak resident set size of this process where supported
+    (Linux >= 4.0). Return True on success."""
+    try:
+        with open('/proc/self/clear_refs', 'w') as f:
+            f.write('5')
+        return True
+    except (IOError, OSError):
+        return False
+
+def _peakMemory():
+    """Return the peak resident set size in KiB, or None if unknown"""
+    try:
+        with open('/proc/self/status') as f:
+            for line in f:
+                if line.startswith('VmHWM:'):
+                    return int(line.split()[1])
+    except (IOError, OSError, ValueError):
+        pass
+    try:
+        import resource
+        rss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+        if sys.platform == 'darwin':
+            rss //= 1024
+        return rss
+    except (ImportError, AttributeError):
+        return None
+
+
+#---------------------------------------------------------------------------
+# workloads
+#---------------------------------------------------------------------------
+
+class Skip(Exception):
+    "Raised by a workload whose required module is not available"
+    pass
+
+def _import(name):
+    try:
+        return __import__(name)
+    except ImportError as e:
+        raise Skip(str(e))
+
+class Workload(object):
+    """Base class of a benchmark workload
+
+    Sub-classes implement setup() and phases(). phases() is a generator
+    yielding the name of each phase after the phase has finished, so that the
+    runner can time the code in between.
+    """
+    name = ''
+    description = ''
+
+    def __init__(self, scale, workdir):
+        self.scale = scale
+        self.workdir = workdir
+        self.doc = None
+        self.params = {}
+
+    def size(self, n, minimum=1):
+        return max(minimum, int(round(n * self.scale)))
+
+    def newDocument(self):
+        self.doc = FreeCAD.newDocument('Benchmark_' + self.name)
+        return self.doc
+
+    def setup(self):
+        pass
+
+    def phases(self):
+        return iter(())
+
+    def teardown(self):
+        if self.doc:
+            FreeCAD.closeDocument(self.doc.Name)
+            self.doc = None
+
+
+class PartDesignChain(Workload):
+    name = 'partdesign'
+    description = 'Body with a chain of additive features, each fused to the previous solid'
+
+    def setup(self):
+        _import('PartDesign')
+        self.count = self.size(200, 2)
+        self.params['features'] = self.count
+        doc = self.newDocument()
+        self.body = doc.addObject('PartDesign::Body', 'Body')
+        self.features = []
+        for i in range(self.count):
+            box = self.body.newObject('PartDesign::AdditiveBox', 'Box')
+            box.Length = 10
+            box.Width = 10
+            box.Height = 10
+            box.Placement.Base = FreeCAD.Vector(7*i, 3*(i%2), 2*(i%3))
+            self.features.append(box)
+
+    def phases(self):
+        self.doc.recompute()
+        yield 'recompute'
+        self.features[0].Length = 11
+        self.doc.recompute()
+        yield 'recompute_touch_first'
+        self.features[-1].Height = 11
+        self.doc.recompute()
+        yield 'recompute_touch_last'
+        self.body.Shape.Volume
+        yield 'shape_query'
+
+
+class LinkArray(Workload):
+    name = 'link'
+    description = 'Large App::Link arrays and sub-object resolution'
+
+    def setup(self):
+        _import('Part')
+        self.count = self.size(10000, 2)
+        self.params['elements'] = self.count
+        doc = self.newDocument()
+        self.box = doc.addObject('Part::Box', 'Box')
+        self.array = doc.addObject('App::Link', 'Array')
+        doc.recompute()
+
+    def phases(self):
+        import Part
+        self.array.LinkedObject = self.box
+        self.array.ElementCount = self.count
+        for i, obj in enumerate(self.array.ElementList):
+            obj.Placement.Base = FreeCAD.Vector(15*(i%100), 15*(i//100), 0)
+        yield 'create'
+        self.doc.recompute()
+        yield 'recompute'
+        for i in range(self.count):
+            self.array.getSubObject('%d.Face1' % i, retType=1)
+        yield 'subobject'
+        Part.getShape(self.array)
+        yield 'shape'
+        self.box.Length = 11
+        self.doc.recompute()
+        Part.getShape(self.array)
+        yield 'shape_touch_linked'
+
+
+class MeshOperations(Workload):
+    name = 'mesh'
+    description = 'Algorithms on a large triangle mesh'
+
+    def setup(self):
+        Mesh = _import('Mesh')
+        target = self.size(10000000, 1000)
+        sampling = max(10, int(math.sqrt(min(target, 200000) / 2)))
+        mesh = Mesh.createSphere(10, sampling)
+        # Double the mesh with translated copies until the target is reached
+        offset = 25
+        while mesh.CountFacets < target:
+            other = mesh.copy()
+            other.translate(offset, 0, 0)
+            mesh.addMesh(other)
+            offset *= 2
+        self.mesh = mesh
+        self.params['facets'] = mesh.CountFacets
+        self.params['points'] = mesh.CountPoints
+        self.filename = os.path.join(self.workdir, 'benchmark.stl')
+
+    def phases(self):
+        import Mesh
+        mesh = self.mesh.copy()
+        yield 'copy'
+        mat = FreeCAD.Matrix()
+        mat.rotateZ(0.1)
+        mesh.transform(mat)
+        yield 'transform'
+        mesh.Volume
+        mesh.Area
+        yield 'volume_area'
+        mesh.getPointNormals()
+        yield 'point_normals'
+        mesh.hasNonManifolds()
+        mesh.hasNonUniformOrientedFacets()
+        yield 'analyze'
+        mesh.removeDuplicatedPoints()
+        mesh.removeDuplicatedFacets()
+        yield 'repair'
+        mesh.write(self.filename)
+        yield 'write_stl'
+        Mesh.Mesh(self.filename)
+        yield 'read_stl'
+
+    def teardown(self):
+        self.mesh = None
+        super(MeshOperations, self).teardown()
+
+
+class SketchSolve(Workload):
+    name = 'sketch'
+    description = 'Fully constrained sketch with a large number of constraints'
+
+    def setup(self):
+        _import('Sketcher')
+        import Part
+        import Sketcher
+        # Each segment of the zig-zag polyline carries three constraints
+        count = self.size(1000, 3)
+        lines = int(math.ceil(count/3.0))
+        doc = self.newDocument()
+        self.sketch = doc.addObject('Sketcher::SketchObject', 'Sketch')
+        geos = []
+        constraints = []
+        p = FreeCAD.Vector(0.5, -0.5, 0)
+        for i in range(lines):
+            # Deliberately off by some amount from the constrained position,
+            # so that the solver has to move every point
+            if i % 2:
+                q = p + FreeCAD.Vector(0.3, 9, 0)
+            else:
+                q = p + FreeCAD.Vector(9, -0.3, 0)
+            geos.append(Part.LineSegment(p, q))
+            if i:
+                constraints.append(Sketcher.Constraint('Coincident', i-1, 2, i, 1))
+            else:
+                constraints.append(Sketcher.Constraint('Coincident', 0, 1, -1, 1))
+            constraints.append(Sketcher.Constraint('Vertical' if i % 2 else 'Horizontal', i))
+            constraints.append(Sketcher.Constraint('Distance', i, 10 + (i % 7) * 0.5))
+            p = q + FreeCAD.Vector(0.1, 0.1, 0)
+        self.geos = geos
+        self.constraints = constraints
+        self.params['geometries'] = lines
+        self.params['constraints'] = len(constraints)
+
+    def phases(self):
+        self.sketch.addGeometry(self.geos, False)
+        self.sketch.addConstraint(self.constraints)
+        yield 'add'
+        self.sketch.solve()
+        yield 'solve'
+        self.doc.recompute()
+        yield 'recompute'
+        self.sketch.setDatum(len(self.constraints) - 1, FreeCAD.Units.Quantity('12 mm'))
+        self.sketch.solve()
+        yield 'solve_change_datum'
+
+
+class SketchJacobian(Workload):
+    name = 'sketch_jacobian'
+    description = 'Large sketch solved with the dense and the sparse Jacobian'
+
+    def setup(self):
+        _import('Sketcher')
+        import Part
+        import Sketcher
+        # Same zig-zag polyline as in SketchSolve, except that it is fixed by
+        # point constraints, as a bare Sketcher.Sketch has no axes
+        lines = self.size(2000, 2)
+        geos = []
+        constraints = [Sketcher.Constraint('DistanceX', 0, 1, 0.0),
+                       Sketcher.Constraint('DistanceY', 0, 1, 0.0)]
+        p = FreeCAD.Vector(0.5, -0.5, 0)
+        for i in range(lines):
+            if i % 2:
+                q = p + FreeCAD.Vector(0.3, 9, 0)
+            else:
+                q = p + FreeCAD.Vector(9, -0.3, 0)
+            geos.append(Part.LineSegment(p, q))
+            if i:
+                constraints.append(Sketcher.Constraint('Coincident', i-1, 2, i, 1))
+            constraints.append(Sketcher.Constraint('Vertical' if i % 2 else 'Horizontal', i))
+            constraints.append(Sketcher.Constraint('Distance', i, 10 + (i % 7) * 0.5))
+            p = q + FreeCAD.Vector(0.1, 0.1, 0)
+        self.geos = geos
+        self.constraints = constraints
+        self.params['geometries'] = lines
+        self.params['constraints'] = len(constraints)
+
+    def solve(self, sparse):
+        import Sketcher
+        sketch = Sketcher.Sketch()
+        sketch.SparseJacobian = sparse
+        sketch.addGeometry(self.geos)
+        sketch.addConstraint(self.constraints)
+        if sketch.solve() != 0:
+            raise RuntimeError('Failed to solve the sketch')
+        return sketch
+
+    def phases(self):
+        # Each phase includes the diagnosis of the sketch, which does not
+        # depend on the type of the Jacobian
+        dense = self.solve(False)
+        yield 'solve_dense'
+        sparse = self.solve(True)
+        yield 'solve_sparse'
+        for a, b in zip(dense.Geometries, sparse.Geometries):
+            if a.EndPoint.distanceToPoint(b.EndPoint) > 1e-6:
+                raise RuntimeError('Dense and sparse solutions differ')
+
+
+class SpreadsheetRecompute(Workload):
+    name = 'spreadsheet'
+    description = 'Spreadsheet with a long dependency chain and a wide fan-out'
+
+    def setup(self):
+        _import('Spreadsheet')
+        self.count = self.size(5000, 2)
+        self.params['cells'] = self.count * 2
+        doc = self.newDocument()
+        self.sheet = doc.addObject('Spreadsheet::Sheet', 'Sheet')
+
+    def phases(self):
+        sheet = self.sheet
+        sheet.set('A1', '1')
+        for i in range(2, self.count+1):
+            sheet.set('A%d' % i, '=A%d + 1' % (i-1))
+        for i in range(1, self.count+1):
+            sheet.set('B%d' % i, '=A%d * 2 + A1' % i)
+        yield 'set'
+        self.doc.recompute()
+        yield 'recompute'
+        sheet.set('A1', '2')
+        self.doc.recompute()
+        yield 'recompute_touch_root'
+        sheet.set('A%d' % self.count, '0')
+        self.doc.recompute()
+        yield 'recompute_touch_leaf'
+
+
+class SaveRestore(Workload):
+    name = 'document'
+    description = 'Save and restore of a document with many objects'
+
+    def setup(self):
+        _import('Part')
+        self.count = self.size(2000, 2)
+        self.params['objects'] = self.count * 2
+        doc = self.newDocument()
+        pairs = []
+        for i in range(self.count):
+            box = doc.addObject('Part::Box', 'Box')
+            box.Placement.Base = FreeCAD.Vector(15*(i%50), 15*(i//50), 0)
+            feat = doc.addObject('Part::Feature', 'Feature')
+            feat.Label2 = 'Feature %d' % i
+            pairs.append((box, feat))
+        doc.recompute()
+        # Plain shapes are saved as BRep files, unlike the boxes
+        for box, feat in pairs:
+            feat.Shape = box.Shape
+        self.filename = os.path.join(self.workdir, 'benchmark.FCStd')
+
+    def phases(self):
+        self.doc.saveAs(self.filename)
+        yield 'save'
+        name = self.doc.Name
+        FreeCAD.closeDocument(name)
+        self.doc = None
+        yield 'close'
+        self.doc = FreeCAD.openDocument(self.filename)
+        yield 'restore'
+        self.doc.recompute()
+        yield 'recompute'
+
+
+workloads = [PartDesignChain, LinkArray, MeshOperations,
+             SketchSolve, SketchJacobian, SpreadsheetRecompute, SaveRestore]
+
+
+#---------------------------------------------------------------------------
+# runner
+#---------------------------------------------------------------------------
+
+def _runWorkload(cls, scale, repeat, workdir, profile):
+    result = {'name': cls.name,
+              'description': cls.description,
+              'status': 'ok',
+              'phases': {}}
+    try:
+        for i in range(repeat):
+            workload = cls(scale, workdir)
+            try:
+                gc.collect()
+                workload.setup()
+                gc.collect()
+                resetPeak = _resetPeakMemory()
+                startMemory = _peakMemory()
+                if profile and i == 0 and hasattr(FreeCAD, 'startProfiler'):
+                    FreeCAD.startProfiler()
+                total = 0.0
+                tic = time.perf_counter()
+                for phase in workload.phases():
+                    toc = time.perf_counter()
+                    result['phases'].setdefault(phase, []).append(toc - tic)
+                    total += toc - tic
+                    tic = time.perf_counter()
+                if profile and i == 0 and hasattr(FreeCAD, 'stopProfiler'):
+                    FreeCAD.stopProfiler(os.path.join(profile, cls.name + '.json'))
+                result.setdefault('total', []).append(total)
+                peak = _peakMemory()
+                if peak is not None:
+                    result['peak_rss_kb'] = max(result.get('peak_rss_kb', 0), peak)
+                    # Without peak reset, the process wide peak is monotonic
+                    # and only an increase is attributable to this workload
+                    if resetPeak or startMemory is None:
+                        result['peak_rss_reset'] = resetPeak
+                    else:
+                        result['peak_rss_reset'] = False
+                        result['peak_rss_increase_kb'] = max(
+                                result.get('peak_rss_increase_kb', 0), peak - startMemory)
+                result['params'] = workload.params
+            finally:
+                workload.teardown()
+    except Skip as e:
+        result['status'] = 'skipped'
+        result['message'] = str(e)
+    except Exception as e:
+        result['status'] = 'error'
+        result['message'] = '%s: %s' % (type(e).__name__, e)
+    finally:
+        if profile and hasattr(FreeCAD, 'stopProfiler'):
+            FreeCAD.stopProfiler()
+
+    # Report the best of all repetitions, which is the least noisy statistic
+    # for comparing builds. The raw samples are kept for further analysis.
+    result['samples'] = result.pop('phases')
+    result['phases'] = dict((k, min(v)) for k, v in result['samples'].items())
+    if 'total' in result:
+        result['samples']['total'] = result['total']
+        result['total'] = min(result['total'])
+    return result
+
+
+def run(names=None, scale=1.0, repeat=1, output=None, profile=None, stream=None):
+    """Run the benchmark
+
+    names:   list of workload names to run, all if None
+    scale:   multiplier of the workload sizes
+    repeat:  number of repetitions of each workload, the best is reported
+    output:  file name to write the JSON report to
+    profile: directory to write a trace-event file of each workload to
+    stream:  stream to print a progress summary to, default sys.stdout
+
+    Returns the report as a dictionary.
+    """
+    if stream is None:
+        stream = sys.stdout
+    selected = [w for w in workloads if not names or w.name in names]
+    if names:
+        unknown = set(names) - set(w.name for w in workloads)
+        if unknown:
+            raise ValueError('Unknown workload(s): %s' % ', '.join(sorted(unknown)))
+    if profile and not os.path.isdir(profile):
+        os.makedirs(profile)
+
+    report = {'version': '.'.join(FreeCAD.Version()[0:3]),
+              'revision': FreeCAD.Version()[3] if len(FreeCAD.Version()) > 3 else '',
+              'platform': platform.platform(),
+              'python': platform.python_version(),
+              'timestamp': time.strftime('%Y-%m-%dT%H:%M:%S'),
+              'scale': scale,
+              'repeat': repeat,
+              'results': []}
+
+    workdir = tempfile.mkdtemp(prefix='FreeCADBenchmark')
+    try:
+        for cls in selected:
+            result = _runWorkload(cls, scale, repeat, workdir, profile)
+            report['results'].append(result)
+            if result['status'] == 'ok':
+                stream.write('%-12s %10.3f s %10s KiB  %s\n' % (
+                    cls.name, result['total'], result.get('peak_rss_kb', '?'),
+                    ', '.join('%s=%.3f' % (k, result['phases'][k])
+                              for k in sorted(result['phases']))))
+            else:
+                stream.write('%-12s %s: %s\n' % (cls.name, result['status'], result['message']))
+            stream.flush()
+    finally:
+        shutil.rmtree(workdir, ignore_errors=True)
+
+    if output:
+        with open(output, 'w') as f:
+            json.dump(report, f, indent=1, sort_keys=True)
+    return report
+
+
+def _scriptArgs():
+    # Inside FreeCAD sys.argv holds the arguments of the application itself,
+    # e.g. ['FreeCADCmd', '-c', ...] or ['FreeCADCmd', 'Benchmark.py'], so
+    # only use it if this file is the script run by a Python interpreter.
+    if sys.argv and os.path.basename(sys.argv[0]) == os.path.basename(__file__):
+        return sys.argv[1:]
+    return []
+
+
+def main(argv=None):
+    """Command line entry, see --help
+
+    argv: list of arguments, default the command line arguments when run as a
+    script by a Python interpreter, and none when run inside FreeCAD
+    """
+    import argparse
+    parser = argparse.ArgumentParser(prog='Benchmark',
+            description='Run FreeCAD benchmark workloads: '
+                + ', '.join(w.name for w in workloads))
+    parser.add_argument('names', nargs='*', metavar='workload',
+            help='workloads to run, default all')
+    parser.add_argument('--scale', type=float, default=1.0,
+            help='multiplier of the workload sizes (default 1.0)')
+    parser.add_argument('--repeat', type=int, default=1,
+            help='repetitions of each workload, the best is reported (default 1)')
+    parser.add_argument('--output', help='file name of the JSON report')
+    parser.add_argument('--profile', metavar='DIR',
+            help='write a trace-event file of each workload to this directory')
+    args = parser.parse_args(_scriptArgs() if argv is None else argv)
+    report = run(args.names, args.scale, max(1, args.repeat), args.output, args.profile)
+    return 1 if any(r['status'] == 'error' for r in report['results']) else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -225,6 +225,28 @@ class DocumentBasicCases(unittest.TestCase):
     cpy = self.Doc.copyObject(obj)
     self.assertListEqual(obj.PlmList, cpy.PlmList)
 
+  def testObjectIndex(self):
+    L1 = self.Doc.addObject("App::FeatureTest","Label_1")
+    G1 = self.Doc.addObject("App::DocumentObjectGroup","Group")
+    self.assertEqual(self.Doc.findObjects("App::FeatureTest"), [L1])
+    self.assertEqual(self.Doc.findObjects("App::DocumentObject"), [L1, G1])
+    L2 = self.Doc.addObject("App::FeatureTest","Label_2")
+    self.assertEqual(self.Doc.findObjects("App::FeatureTest"), [L1, L2])
+    self.assertEqual(self.Doc.findObjects("App::DocumentObject", Name="Label"), [L1, L2])
+    self.assertEqual(self.Doc.getObjectsByLabel("Label_2"), [L2])
+    L2.Label = "Renamed"
+    self.assertEqual(self.Doc.getObjectsByLabel("Label_2"), [])
+    self.assertEqual(self.Doc.getObjectsByLabel("Renamed"), [L2])
+    self.Doc.openTransaction("Remove")
+    self.Doc.removeObject(L1.Name)
+    self.Doc.commitTransaction()
+    self.assertEqual(self.Doc.findObjects("App::FeatureTest"), [L2])
+    self.assertEqual(self.Doc.getObjectsByLabel("Label_1"), [])
+    self.Doc.undo()
+    L1 = self.Doc.getObject("Label_1")
+    self.assertEqual(self.Doc.findObjects("App::FeatureTest"), [L2, L1])
+    self.assertEqual(self.Doc.getObjectsByLabel("Label_1"), [L1])
+
   def testAddRemove(self):
     L1 = self.Doc.addObject("App::FeatureTest","Label_1")
     # must delete object
@@ -545,6 +567,90 @@ class DocumentRecomputeCases(unittest.TestCase):
     self.L1.Link = self.L2
     self.L2.Link = self.L3
 
+  def testProfiler(self):
+    import json
+    self.L1.Link = self.L2
+    FreeCAD.startProfiler()
+    self.Doc.recompute()
+    path = tempfile.gettempdir() + os.sep + "RecomputeProfile.json"
+    self.assertGreater(FreeCAD.stopProfiler(path), 0)
+    with open(path) as f:
+      events = json.load(f)["traceEvents"]
+    os.remove(path)
+    names = [e["name"] for e in events]
+    self.assertIn("Document::recompute", names)
+    details = [e["args"]["detail"] for e in events
+               if e["name"] == "Document::_recomputeFeature"]
+    self.assertIn("RecomputeTests#Label_1", details)
+
+  def testRecomputeStats(self):
+    self.L1.Link = self.L2
+    self.Doc.recompute()
+    stats = self.L1.RecomputeStats
+    self.assertEqual(stats["count"], self.L1.ExecCount)
+    self.assertGreaterEqual(stats["max"], stats["last"])
+    self.assertAlmostEqual(stats["total"], stats["average"] * stats["count"])
+    self.L1.touch()
+    self.Doc.recompute()
+    self.assertEqual(self.L1.RecomputeStats["count"], stats["count"] + 1)
+    report = self.Doc.getRecomputeReport()
+    self.assertEqual(set(o for o, s in report), set([self.L1, self.L2, self.L3]))
+    totals = [s["total"] for o, s in report]
+    self.assertEqual(totals, sorted(totals, reverse=True))
+    self.assertEqual(len(self.Doc.getRecomputeReport(1)), 1)
+    self.Doc.resetRecomputeStats()
+    self.assertEqual(self.L1.RecomputeStats["count"], 0)
+    self.assertEqual(self.Doc.getRecomputeReport(), [])
+
+  class CountFeature():
+    def __init__(self, obj):
+      obj.addProperty("App::PropertyInteger","Value","Base","",8)
+      obj.addProperty("App::PropertyLink","Source","Base")
+      obj.Proxy = self
+      self.abort = False
+
+    def execute(self, obj):
+      obj.Value += 1
+      if self.abort:
+        # like pressing ESC, the recompute is aborted after this object
+        FreeCAD.Base.ProgressIndicator().cancel()
+
+  def testAbortRollback(self):
+    param = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Document")
+    canAbort = param.GetBool("CanAbortRecompute", True)
+    rollback = param.GetBool("RollbackAbortedRecompute", True)
+    source = self.Doc.addObject("App::FeaturePython","Source")
+    self.CountFeature(source)
+    target = self.Doc.addObject("App::FeaturePython","Target")
+    self.CountFeature(target)
+    target.Source = source
+    self.Doc.recompute()
+    self.assertEqual((source.Value, target.Value), (1, 1))
+    # the progress bar of the GUI would ask for confirmation
+    FreeCAD.silenceSequencer()
+    try:
+      param.SetBool("CanAbortRecompute", True)
+      param.SetBool("RollbackAbortedRecompute", True)
+      source.Proxy.abort = True
+      source.touch()
+      self.Doc.recompute()
+      # source was executed before the abort and must be restored
+      self.assertEqual((source.Value, target.Value), (1, 1))
+      self.assertTrue(source.isTouched())
+      source.Proxy.abort = False
+      self.Doc.recompute()
+      self.assertEqual((source.Value, target.Value), (2, 2))
+
+      param.SetBool("RollbackAbortedRecompute", False)
+      source.Proxy.abort = True
+      source.touch()
+      self.Doc.recompute()
+      self.assertEqual((source.Value, target.Value), (3, 2))
+    finally:
+      FreeCAD.silenceSequencer(False)
+      param.SetBool("CanAbortRecompute", canAbort)
+      param.SetBool("RollbackAbortedRecompute", rollback)
+
   def testRecompute(self):
 
     # sequence to test recompute behaviour
@@ -719,6 +825,21 @@ class UndoRedoCases(unittest.TestCase):
     self.Doc.clearUndos()
     self.assertEqual(self.Doc.ActiveObject,None)
 
+  def testUndoMemSize(self):
+    self.Doc.getObject("Base").String = "a string to be kept in the undo stack"
+    # switch on the Undo
+    self.Doc.UndoMode = 1
+    self.assertEqual(self.Doc.UndoRedoMemSize,0)
+
+    self.Doc.openTransaction("Transaction1")
+    self.Doc.getObject("Base").String = "another string"
+    self.Doc.commitTransaction()
+    size = self.Doc.UndoRedoMemSize
+    self.assertGreater(size,0)
+
+    self.Doc.clearUndos()
+    self.assertEqual(self.Doc.UndoRedoMemSize,0)
+
   def testUndo(self):
     # switch on the Undo
     self.Doc.UndoMode = 1
@@ -1228,6 +1349,26 @@ class DocumentGroupCases(unittest.TestCase):
     self.prt.removeObject(self.fus1)
     self.failUnless(len(self.prt.Group)==0)
 
+  def testSubObjectCache(self):
+    outer = self.Doc.addObject("App::Part","Outer")
+    inner = self.Doc.addObject("App::Part","Inner")
+    outer.addObject(inner)
+    inner.Placement.Base = FreeCAD.Vector(1,0,0)
+
+    obj, mat = outer.getSubObject("Inner.", retType=1, matrix=FreeCAD.Matrix())
+    self.assertEqual(obj, inner)
+    self.assertEqual(mat.A14, 1)
+
+    # repeated queries must see placement changes
+    outer.Placement.Base = FreeCAD.Vector(2,0,0)
+    obj, mat = outer.getSubObject("Inner.", retType=1, matrix=FreeCAD.Matrix())
+    self.assertEqual(obj, inner)
+    self.assertEqual(mat.A14, 3)
+
+    # and object removal
+    self.Doc.removeObject("Inner")
+    self.assertEqual(outer.getSubObject("Inner.", retType=1), None)
+
   def tearDown(self):
     # closing doc
     FreeCAD.closeDocument("GroupTests")